@@ -0,0 +1,81 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef BENCHMARK_COMMON_HH_
+#define BENCHMARK_COMMON_HH_
+
+#include <algorithm>
+#include <ctime>
+#include <vector>
+
+namespace OpenVolumeMesh {
+
+/// Cells of a grid of _n^3 cubes, each split into six positively
+/// oriented tetrahedra, for vertices numbered x + (_n+1) * (y + (_n+1) * z)
+inline std::vector<int> tet_grid_cells(int _n) {
+
+    const int m = _n + 1;
+
+    // Paths from corner 0 to corner 7 along the three axes, the odd
+    // permutations need to be flipped
+    static const int paths[6][3] = { {1, 2, 4}, {1, 4, 2}, {2, 1, 4}, {2, 4, 1}, {4, 1, 2}, {4, 2, 1} };
+    static const bool flip[6] = { false, true, true, false, false, true };
+
+    std::vector<int> tets;
+    tets.reserve(24 * _n * _n * _n);
+    for(int z = 0; z < _n; ++z)
+        for(int y = 0; y < _n; ++y)
+            for(int x = 0; x < _n; ++x) {
+                int corners[8];
+                for(int c = 0; c < 8; ++c) {
+                    corners[c] = (x + (c & 1)) + m * (y + ((c >> 1) & 1)) + m * m * (z + ((c >> 2) & 1));
+                }
+                for(int t = 0; t < 6; ++t) {
+                    int tet[4] = { corners[0], corners[paths[t][0]],
+                                   corners[paths[t][0] | paths[t][1]], corners[7] };
+                    if(flip[t]) std::swap(tet[1], tet[2]);
+                    tets.insert(tets.end(), tet, tet + 4);
+                }
+            }
+    return tets;
+}
+
+inline double seconds_since(std::clock_t _start) {
+    return double(std::clock() - _start) / CLOCKS_PER_SEC;
+}
+
+} // Namespace OpenVolumeMesh
+
+#endif /* BENCHMARK_COMMON_HH_ */
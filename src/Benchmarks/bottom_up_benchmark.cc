@@ -0,0 +1,129 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*
+ * Measures the time needed to (re-)enable the bottom-up incidences
+ * of a hexahedral grid with one thread and with the given number of threads.
+ *
+ * Usage: bottom_up_benchmark [grid resolution] [threads]
+ */
+
+// C++ includes
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+// Include hexahedral mesh kernel
+#include <OpenVolumeMesh/Mesh/HexahedralMesh.hh>
+
+typedef OpenVolumeMesh::Geometry::Vec3d                  Vec3d;
+typedef OpenVolumeMesh::GeometricHexahedralMeshV3d       HexMesh;
+
+// Wall clock time in seconds
+double now() {
+#ifndef _WIN32
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+#else
+    return (double)std::clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+// Build an n x n x n grid of hexahedra
+void build_grid(HexMesh& _mesh, int _n) {
+
+    const int n = _n + 1;
+    for(int k = 0; k < n; ++k)
+        for(int j = 0; j < n; ++j)
+            for(int i = 0; i < n; ++i)
+                _mesh.add_vertex(Vec3d(i, j, k));
+
+    std::vector<OpenVolumeMesh::VertexHandle> vs(8);
+    for(int k = 0; k < _n; ++k) {
+        for(int j = 0; j < _n; ++j) {
+            for(int i = 0; i < _n; ++i) {
+                const int v = (k * n + j) * n + i;
+                vs[0] = OpenVolumeMesh::VertexHandle(v);
+                vs[1] = OpenVolumeMesh::VertexHandle(v + 1);
+                vs[2] = OpenVolumeMesh::VertexHandle(v + n + 1);
+                vs[3] = OpenVolumeMesh::VertexHandle(v + n);
+                vs[4] = OpenVolumeMesh::VertexHandle(v + n * n);
+                vs[5] = OpenVolumeMesh::VertexHandle(v + n * n + n);
+                vs[6] = OpenVolumeMesh::VertexHandle(v + n * n + n + 1);
+                vs[7] = OpenVolumeMesh::VertexHandle(v + n * n + 1);
+                _mesh.add_cell(vs);
+            }
+        }
+    }
+}
+
+int main(int _argc, char** _argv) {
+
+    const int n = (_argc > 1) ? std::atoi(_argv[1]) : 40;
+    const unsigned int threads = (_argc > 2) ? (unsigned int)std::atoi(_argv[2]) : 4u;
+
+    HexMesh mesh;
+    build_grid(mesh, n);
+
+    std::cout << mesh.n_cells() << " cells, " << mesh.n_faces() << " faces, "
+              << mesh.n_edges() << " edges" << std::endl;
+
+    const unsigned int n_threads[2] = { 1u, threads };
+    for(int t = 0; t < 2; ++t) {
+
+        mesh.set_num_threads(n_threads[t]);
+
+        // Face incidences alone: computed and all edges' halffaces reordered
+        mesh.enable_face_bottom_up_incidences(false);
+        double start = now();
+        mesh.enable_face_bottom_up_incidences(true);
+        const double t_face = now() - start;
+
+        mesh.enable_bottom_up_incidences(false);
+        start = now();
+        mesh.enable_bottom_up_incidences(true);
+        const double t_all = now() - start;
+
+        std::cout << n_threads[t] << " thread(s): face incidences + reordering "
+                  << t_face << " s, all incidences " << t_all << " s" << std::endl;
+    }
+
+    return 0;
+}
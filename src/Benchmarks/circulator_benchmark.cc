@@ -0,0 +1,226 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*
+ * Measures the construction of VertexCellIter, VertexFaceIter,
+ * CellVertexIter and CellCellIter, k-ring queries, halfface walks and
+ * adjacent_halfface_in_cell() and counts the heap allocations they make.
+ *
+ * Usage: circulator_benchmark [cubes per axis] [repetitions]
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <set>
+
+#include <OpenVolumeMesh/Mesh/TetrahedralMesh.hh>
+
+#include "benchmark_common.hh"
+
+using namespace OpenVolumeMesh;
+
+// Count all heap allocations of the process
+static size_t n_allocations = 0;
+
+void* operator new(size_t _size) {
+    ++n_allocations;
+    void* p = std::malloc(_size ? _size : 1u);
+    if(!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* _p) throw() {
+    std::free(_p);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void* _p, size_t) throw() {
+    std::free(_p);
+}
+#endif
+
+template <class CirculatorT, class HandleT>
+void run(const char* _name, const TopologyKernel& _mesh, size_t _n, int _reps) {
+
+    long checksum = 0;
+    const size_t allocations = n_allocations;
+    const std::clock_t start = std::clock();
+    for(int r = 0; r < _reps; ++r) {
+        for(size_t i = 0; i < _n; ++i) {
+            for(CirculatorT it(HandleT((int)i), &_mesh); it.valid(); ++it) {
+                checksum += it->idx();
+            }
+        }
+    }
+    const double t = seconds_since(start);
+    const double n_constructed = double(_n) * _reps;
+
+    std::cout << _name << ": " << 1e9 * t / n_constructed << " ns, "
+              << double(n_allocations - allocations) / n_constructed
+              << " allocations per circulator (checksum " << checksum << ")" << std::endl;
+}
+
+// Two-ring of every vertex, via nested circulators and a set or via vertex_k_ring()
+void run_k_ring(const TopologyKernel& _mesh, int _reps) {
+
+    const size_t n = _mesh.n_vertices();
+    long checksum[2] = { 0, 0 };
+    double t[2];
+    size_t allocations[2];
+
+    std::clock_t start = std::clock();
+    size_t allocations_start = n_allocations;
+    for(int r = 0; r < _reps; ++r) {
+        for(size_t i = 0; i < n; ++i) {
+            std::set<VertexHandle> ring;
+            for(VertexVertexIter it = _mesh.vv_iter(VertexHandle((int)i)); it.valid(); ++it) {
+                for(VertexVertexIter it2 = _mesh.vv_iter(*it); it2.valid(); ++it2) {
+                    ring.insert(*it2);
+                }
+                ring.insert(*it);
+            }
+            ring.erase(VertexHandle((int)i));
+            checksum[0] += (long)ring.size();
+        }
+    }
+    t[0] = seconds_since(start);
+    allocations[0] = n_allocations - allocations_start;
+
+    KRingScratch scratch;
+    std::vector<VertexHandle> ring;
+    start = std::clock();
+    allocations_start = n_allocations;
+    for(int r = 0; r < _reps; ++r) {
+        for(size_t i = 0; i < n; ++i) {
+            _mesh.vertex_k_ring(VertexHandle((int)i), 2, ring, scratch);
+            checksum[1] += (long)ring.size();
+        }
+    }
+    t[1] = seconds_since(start);
+    allocations[1] = n_allocations - allocations_start;
+
+    const char* names[2] = { "2-ring (nested VertexVertexIter + std::set)", "2-ring (vertex_k_ring)" };
+    for(int v = 0; v < 2; ++v) {
+        std::cout << names[v] << ": " << 1e9 * t[v] / (double(n) * _reps) << " ns, "
+                  << double(allocations[v]) / (double(n) * _reps)
+                  << " allocations per query (checksum " << checksum[v] << ")" << std::endl;
+    }
+    if(checksum[0] != checksum[1]) {
+        std::cerr << "Checksums differ!" << std::endl;
+    }
+}
+
+// Walk around every halfface with next_halfedge_in_halfface()
+void run_halfface_walk(const TopologyKernel& _mesh, int _reps) {
+
+    const size_t n = _mesh.n_halffaces();
+    long checksum = 0;
+    const size_t allocations = n_allocations;
+    const std::clock_t start = std::clock();
+    for(int r = 0; r < _reps; ++r) {
+        for(size_t i = 0; i < n; ++i) {
+            const HalfFaceHandle hfh((int)i);
+            const HalfEdgeHandle first = _mesh.corner_halfedge(HalfFaceCorner(hfh, 0u));
+            HalfEdgeHandle heh = first;
+            do {
+                checksum += heh.idx();
+                heh = _mesh.next_halfedge_in_halfface(heh, hfh);
+            } while(heh != first);
+        }
+    }
+    const double t = seconds_since(start);
+
+    std::cout << "Halfface walk (next_halfedge_in_halfface): " << 1e9 * t / (double(n) * _reps) << " ns, "
+              << double(n_allocations - allocations) / (double(n) * _reps)
+              << " allocations per halfface (checksum " << checksum << ")" << std::endl;
+}
+
+// Adjacent halfface of every halfedge of every halfface of every cell
+void run_adjacent_halfface(const char* _name, const TopologyKernel& _mesh, int _reps) {
+
+    long checksum = 0;
+    size_t n = 0;
+    const size_t allocations = n_allocations;
+    const std::clock_t start = std::clock();
+    for(int r = 0; r < _reps; ++r) {
+        for(size_t c = 0; c < _mesh.n_cells(); ++c) {
+            const OpenVolumeMeshCell::HalfFaceView hfs = _mesh.cell(CellHandle((int)c)).halffaces();
+            for(size_t i = 0; i < hfs.size(); ++i) {
+                const OpenVolumeMeshFace::HalfEdgeView hes = _mesh.face(_mesh.face_handle(hfs[i])).halfedges();
+                for(size_t j = 0; j < hes.size(); ++j, ++n) {
+                    checksum += _mesh.adjacent_halfface_in_cell(hfs[i], hes[j]).idx();
+                }
+            }
+        }
+    }
+    const double t = seconds_since(start);
+
+    std::cout << _name << ": " << 1e9 * t / double(n) << " ns, "
+              << double(n_allocations - allocations) / double(n)
+              << " allocations per query (checksum " << checksum << ")" << std::endl;
+}
+
+int main(int _argc, char** _argv) {
+
+    const int n = (_argc > 1) ? std::atoi(_argv[1]) : 20;
+    const int reps = (_argc > 2) ? std::atoi(_argv[2]) : 5;
+
+    TetrahedralMeshTopologyKernel mesh;
+    mesh.add_vertices((n + 1) * (n + 1) * (n + 1));
+    const std::vector<int> tets = tet_grid_cells(n);
+    mesh.add_cells(&tets[0], tets.size() / 4);
+
+    std::cout << "Mesh: " << mesh.n_vertices() << " vertices, " << mesh.n_cells() << " cells" << std::endl;
+
+    run<VertexCellIter, VertexHandle>("VertexCellIter", mesh, mesh.n_vertices(), reps);
+    run<VertexFaceIter, VertexHandle>("VertexFaceIter", mesh, mesh.n_vertices(), reps);
+    run<CellVertexIter, CellHandle>("CellVertexIter", mesh, mesh.n_cells(), reps);
+    run<CellCellIter, CellHandle>("CellCellIter", mesh, mesh.n_cells(), reps);
+
+    run_k_ring(mesh, reps);
+    run_halfface_walk(mesh, reps);
+
+    mesh.enable_vertex_cell_incidences();
+    run<VertexCellIter, VertexHandle>("VertexCellIter (vertex-cell incidences)", mesh, mesh.n_vertices(), reps);
+
+    run_adjacent_halfface("adjacent_halfface_in_cell", mesh, reps);
+    mesh.enable_cell_halfface_adjacency();
+    run_adjacent_halfface("adjacent_halfface_in_cell (halfface adjacency)", mesh, reps);
+
+    mesh.enable_cell_neighbor_table();
+    run<CellCellIter, CellHandle>("CellCellIter (cell neighbor table)", mesh, mesh.n_cells(), reps);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*
+ * Compares deleting scattered vertices of a tetrahedral mesh one after
+ * the other with deferred deletion and garbage collection in one pass.
+ *
+ * Usage: deletion_benchmark [cubes per axis] [every n-th vertex]
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <OpenVolumeMesh/Mesh/TetrahedralMesh.hh>
+
+#include "benchmark_common.hh"
+
+using namespace OpenVolumeMesh;
+using OpenVolumeMesh::Geometry::Vec3d;
+
+void generate_tet_grid(GeometricTetrahedralMeshV3d& _mesh, int _n) {
+
+    const int m = _n + 1;
+    _mesh.reserve(m * m * m, 0, 0, 6 * _n * _n * _n);
+
+    for(int z = 0; z < m; ++z)
+        for(int y = 0; y < m; ++y)
+            for(int x = 0; x < m; ++x)
+                _mesh.add_vertex(Vec3d(x, y, z));
+
+    const std::vector<int> tets = tet_grid_cells(_n);
+    _mesh.add_cells(&tets[0], tets.size() / 4);
+}
+
+int main(int _argc, char** _argv) {
+
+    const int n = (_argc > 1) ? std::atoi(_argv[1]) : 20;
+    const int step = (_argc > 2) ? std::atoi(_argv[2]) : 7;
+
+    GeometricTetrahedralMeshV3d meshes[2];
+    double t_delete[2];
+    for(int i = 0; i < 2; ++i) {
+        GeometricTetrahedralMeshV3d& mesh = meshes[i];
+        generate_tet_grid(mesh, n);
+        mesh.enable_deferred_deletion(i == 1);
+        mesh.enable_fast_deletion(true);
+
+        const std::clock_t start = std::clock();
+        // From the back, so that fast deletion leaves the remaining handles alone
+        for(int v = (int)mesh.n_vertices() - 1; v >= 0; v -= step) {
+            mesh.delete_vertex(VertexHandle(v));
+        }
+        mesh.collect_garbage();
+        t_delete[i] = seconds_since(start);
+    }
+
+    std::cout << "Mesh: " << meshes[1].n_vertices() << " vertices, " << meshes[1].n_faces()
+              << " faces, " << meshes[1].n_cells() << " cells remaining" << std::endl;
+    std::cout << "Per-entity deletion:   " << t_delete[0] << " s" << std::endl;
+    std::cout << "Garbage collection:    " << t_delete[1] << " s" << std::endl;
+
+    if(meshes[0].n_vertices() != meshes[1].n_vertices() || meshes[0].n_edges() != meshes[1].n_edges() ||
+       meshes[0].n_faces() != meshes[1].n_faces() || meshes[0].n_cells() != meshes[1].n_cells()) {
+        std::cerr << "Entity count mismatch" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
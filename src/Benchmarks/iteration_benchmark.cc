@@ -0,0 +1,175 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*
+ * Compares entity iteration on a polymorphic tetrahedral mesh with the
+ * statically bound StaticKernel variant and with entity ranges, and
+ * boundary queries with and without the boundary index.
+ *
+ * Usage: iteration_benchmark [cubes per axis] [repetitions]
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <OpenVolumeMesh/Mesh/TetrahedralMesh.hh>
+
+#include "benchmark_common.hh"
+
+using namespace OpenVolumeMesh;
+using OpenVolumeMesh::Geometry::Vec3d;
+
+// Positioned grid with some deleted cells to skip
+template <class MeshT>
+void generate_tet_grid(MeshT& _mesh, int _n) {
+
+    const int m = _n + 1;
+    _mesh.reserve(m * m * m, 0, 0, 6 * _n * _n * _n);
+
+    for(int z = 0; z < m; ++z)
+        for(int y = 0; y < m; ++y)
+            for(int x = 0; x < m; ++x)
+                _mesh.add_vertex(Vec3d(x, y, z));
+
+    const std::vector<int> tets = tet_grid_cells(_n);
+    _mesh.add_cells(&tets[0], tets.size() / 4);
+
+    for(int i = 0; i < (int)_mesh.n_cells(); i += 97) {
+        _mesh.delete_cell(CellHandle(i));
+    }
+}
+
+int main(int _argc, char** _argv) {
+
+    const int n = (_argc > 1) ? std::atoi(_argv[1]) : 40;
+    const int reps = (_argc > 2) ? std::atoi(_argv[2]) : 20;
+
+    GeometricTetrahedralMeshV3d mesh;
+    StaticTetrahedralMeshV3d smesh;
+    generate_tet_grid(mesh, n);
+    generate_tet_grid(smesh, n);
+
+    std::cout << "Mesh: " << mesh.n_vertices() << " vertices, " << mesh.n_halffaces()
+              << " halffaces, " << mesh.n_cells() << " cells" << std::endl;
+
+    // Each variant sums up the same positions and handles
+    Vec3d sum[3] = { Vec3d(0.0, 0.0, 0.0), Vec3d(0.0, 0.0, 0.0), Vec3d(0.0, 0.0, 0.0) };
+    long checksum[3] = { 0, 0, 0 };
+
+    std::clock_t start = std::clock();
+    for(int r = 0; r < reps; ++r) {
+        for(VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it) {
+            sum[0] += mesh.vertex(*v_it);
+        }
+        for(HalfFaceIter hf_it = mesh.halffaces_begin(); hf_it != mesh.halffaces_end(); ++hf_it) {
+            checksum[0] += hf_it->idx();
+        }
+        for(CellIter c_it = mesh.cells_begin(); c_it != mesh.cells_end(); ++c_it) {
+            checksum[0] += c_it->idx();
+        }
+    }
+    const double t_dynamic = seconds_since(start);
+
+    start = std::clock();
+    for(int r = 0; r < reps; ++r) {
+        const StaticEntityRange<StaticTetrahedralMeshV3d::StaticVertexIter> vertices = smesh.static_vertices();
+        for(StaticTetrahedralMeshV3d::StaticVertexIter v_it = vertices.begin(); v_it != vertices.end(); ++v_it) {
+            sum[1] += smesh.vertex(*v_it);
+        }
+        const StaticEntityRange<StaticTetrahedralMeshV3d::StaticHalfFaceIter> halffaces = smesh.static_halffaces();
+        for(StaticTetrahedralMeshV3d::StaticHalfFaceIter hf_it = halffaces.begin(); hf_it != halffaces.end(); ++hf_it) {
+            checksum[1] += hf_it->idx();
+        }
+        const StaticEntityRange<StaticTetrahedralMeshV3d::StaticCellIter> cells = smesh.static_cells();
+        for(StaticTetrahedralMeshV3d::StaticCellIter c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+            checksum[1] += c_it->idx();
+        }
+    }
+    const double t_static = seconds_since(start);
+
+    start = std::clock();
+    for(int r = 0; r < reps; ++r) {
+        const EntityRange<VertexHandle> vertices = mesh.vertex_range();
+        for(EntityRange<VertexHandle>::iterator v_it = vertices.begin(); v_it != vertices.end(); ++v_it) {
+            sum[2] += mesh.vertex(*v_it);
+        }
+        const EntityRange<HalfFaceHandle> halffaces = mesh.halfface_range();
+        for(EntityRange<HalfFaceHandle>::iterator hf_it = halffaces.begin(); hf_it != halffaces.end(); ++hf_it) {
+            checksum[2] += hf_it->idx();
+        }
+        const EntityRange<CellHandle> cells = mesh.cell_range();
+        for(EntityRange<CellHandle>::iterator c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+            checksum[2] += c_it->idx();
+        }
+    }
+    const double t_range = seconds_since(start);
+
+    std::cout << "Polymorphic iteration: " << t_dynamic << " s" << std::endl;
+    std::cout << "Static iteration:      " << t_static << " s" << std::endl;
+    std::cout << "Entity ranges:         " << t_range << " s" << std::endl;
+
+    if(checksum[1] != checksum[0] || checksum[2] != checksum[0] ||
+       (sum[1] - sum[0]).norm() > 1e-6 || (sum[2] - sum[0]).norm() > 1e-6) {
+        std::cerr << "Checksum mismatch" << std::endl;
+        return 1;
+    }
+
+    // Boundary faces and vertices, by scanning the mesh and via the boundary index
+    long boundary[2] = { 0, 0 };
+    double t_boundary[2];
+    for(int i = 0; i < 2; ++i) {
+        mesh.enable_boundary_index(i == 1);
+        start = std::clock();
+        for(int r = 0; r < reps; ++r) {
+            for(BoundaryFaceIter bf_it = mesh.bf_iter(); bf_it.valid(); ++bf_it) {
+                boundary[i] += bf_it->idx();
+            }
+            for(VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it) {
+                boundary[i] += mesh.is_boundary(*v_it);
+            }
+        }
+        t_boundary[i] = seconds_since(start);
+    }
+
+    std::cout << "Boundary (scan):       " << t_boundary[0] << " s" << std::endl;
+    std::cout << "Boundary (index):      " << t_boundary[1] << " s" << std::endl;
+
+    if(boundary[1] != boundary[0]) {
+        std::cerr << "Checksum mismatch" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
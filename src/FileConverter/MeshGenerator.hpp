@@ -10,13 +10,11 @@
 
 #include <vector>
 #include <set>
-#include <map>
 #include <algorithm>
 
 #include <boost/shared_ptr.hpp>
 #include <boost/progress.hpp>
 #include <boost/tuple/tuple.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 
 #include <OpenVolumeMesh/Mesh/PolyhedralMesh.hh>
 #include <OpenVolumeMesh/Geometry/VectorT.hh>
@@ -39,14 +37,18 @@ public:
 
     typedef OpenVolumeMesh::Geometry::Vec3d Vec3d;
 
-    MeshGenerator(PolyhedralMesh& _mesh) : v_component_(0), mesh_(_mesh), progress_() {}
+    MeshGenerator(PolyhedralMesh& _mesh) : v_component_(0), mesh_(_mesh), progress_() {
+        // Shared faces are looked up by their vertices
+        mesh_.enable_face_index();
+    }
     MeshGenerator(const MeshGenerator& _cpy) :
         v_component_(_cpy.v_component_),
         vertex_(0.0, 0.0, 0.0),
         c_vertices_(),
-        faceMap_(),
         mesh_(_cpy.mesh_),
-        progress_() {}
+        progress_() {
+        mesh_.enable_face_index();
+    }
 
     void add_vertex_component(double _comp) {
 
@@ -123,9 +125,14 @@ public:
         for(std::vector<FaceTuple>::const_iterator it = tuples.begin();
                 it != tuples.end(); ++it) {
 
+            std::vector<VertexHandle> v_vec;
+            v_vec.push_back(it->get<0>());
+            v_vec.push_back(it->get<1>());
+            v_vec.push_back(it->get<2>());
+
             // Check if face exists for current tuple
-            FaceMap::iterator f = faceMap_.find(*it);
-            if(f == faceMap_.end()) {
+            HalfFaceHandle hf = mesh_.halfface_extensive(v_vec);
+            if(!hf.is_valid()) {
                 // Face does not exist, create it
 
                 // Find right orientation, s.t. normal
@@ -137,15 +144,8 @@ public:
                 // Get face normal (cross product)
                 Vec3d n = (e1 % e2).normalize();
 
-                std::vector<VertexHandle> v_vec;
-                v_vec.push_back(it->get<0>());
-                v_vec.push_back(it->get<1>());
-                v_vec.push_back(it->get<2>());
                 FaceHandle fh = mesh_.add_face(v_vec);
 
-                // Add face to face map
-                faceMap_[*it] = fh;
-
                 // Check whether normal points inside cell
                 if(((midP - mesh_.vertex(it->get<0>())) | n) > 0.0) {
 
@@ -163,7 +163,7 @@ public:
             } else {
 
                 // Face exists, find right orientation
-                FaceHandle fh = f->second;
+                FaceHandle fh = mesh_.face_handle(hf);
 
                 std::vector<HalfEdgeHandle> hes = mesh_.face(fh).halfedges();
 
@@ -203,15 +203,11 @@ public:
 
 private:
 
-    typedef std::map<FaceTuple, OpenVolumeMesh::FaceHandle> FaceMap;
-
     unsigned int v_component_;
     OpenVolumeMesh::Geometry::Vec3d vertex_;
 
     std::vector<VertexHandle> c_vertices_;
 
-    FaceMap faceMap_;
-
     PolyhedralMesh& mesh_;
 
     boost::shared_ptr<boost::progress_display> progress_;
@@ -115,6 +115,23 @@ private:
 
     void compute_face_normal(const FaceHandle& _fh);
 
+    // Functors to compute the normals in parallel
+    class VertexNormalFunctor {
+    public:
+        explicit VertexNormalFunctor(NormalAttrib& _attrib) : attrib_(_attrib) {}
+        void operator()(const VertexHandle& _vh) const { attrib_.compute_vertex_normal(_vh); }
+    private:
+        NormalAttrib& attrib_;
+    };
+
+    class FaceNormalFunctor {
+    public:
+        explicit FaceNormalFunctor(NormalAttrib& _attrib) : attrib_(_attrib) {}
+        void operator()(const FaceHandle& _fh) const { attrib_.compute_face_normal(_fh); }
+    private:
+        NormalAttrib& attrib_;
+    };
+
     GeomKernelT& kernel_;
 
     VertexPropertyT<typename GeomKernelT::PointT> v_normals_;
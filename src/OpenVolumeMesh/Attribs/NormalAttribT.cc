@@ -75,9 +75,7 @@ void NormalAttrib<GeomKernelT>::update_vertex_normals() {
     // Compute face normals
     update_face_normals();
 
-    for(VertexIter v_it = kernel_.v_iter(); v_it.valid(); ++v_it) {
-        compute_vertex_normal(*v_it);
-    }
+    kernel_.parallel_for_vertices(VertexNormalFunctor(*this));
 }
 
 template <class GeomKernelT>
@@ -88,11 +86,9 @@ void NormalAttrib<GeomKernelT>::update_face_normals() {
         return;
     }
 
-    for(FaceIter f_it = kernel_.f_iter(); f_it.valid(); ++f_it) {
-        // Assume the face is planar, so just take the
-        // first two edges
-        compute_face_normal(*f_it);
-    }
+    // Assume the faces are planar, so just take the
+    // first two edges
+    kernel_.parallel_for_faces(FaceNormalFunctor(*this));
 }
 
 template <class GeomKernelT>
@@ -128,8 +124,8 @@ void NormalAttrib<GeomKernelT>::compute_face_normal(const FaceHandle& _fh) {
         return;
     }
 
-    const std::vector<HalfEdgeHandle>& halfedges = kernel_.face(_fh).halfedges();
-    std::vector<HalfEdgeHandle>::const_iterator he_it = halfedges.begin();
+    const OpenVolumeMeshFace::HalfEdgeView halfedges = kernel_.face(_fh).halfedges();
+    OpenVolumeMeshFace::HalfEdgeView::const_iterator he_it = halfedges.begin();
 
     typename GeomKernelT::PointT p1 = kernel_.vertex(kernel_.halfedge(*he_it).from_vertex());
     typename GeomKernelT::PointT p2 = kernel_.vertex(kernel_.halfedge(*he_it).to_vertex());
@@ -45,6 +45,7 @@
 #endif
 
 #include "StatusAttrib.hh"
+#include "../Core/TopologyKernel.hh"
 
 namespace OpenVolumeMesh {
 
@@ -68,95 +69,119 @@ StatusAttrib::~StatusAttrib() {
 
 //========================================================================================
 
-void StatusAttrib::mark_higher_dim_entities() {
+void StatusAttrib::garbage_collection(bool _preserveManifoldness) {
 
-    // Edges
-    if(kernel_.has_vertex_bottom_up_incidences()) {
+    HandleRemap remap;
+    garbage_collection(remap, _preserveManifoldness);
+}
 
-        for(VertexIter v_it = kernel_.vertices_begin(); v_it != kernel_.vertices_end(); ++v_it) {
-            if(v_status_[v_it->idx()].deleted()) {
-                for(VertexOHalfEdgeIter voh_it = kernel_.voh_iter(*v_it);
-                        voh_it.valid(); ++voh_it) {
-                    e_status_[kernel_.edge_handle(*voh_it).idx()].set_deleted(true);
-                }
-            }
-        }
-    } else {
+//========================================================================================
 
-        for(EdgeIter e_it = kernel_.edges_begin(); e_it != kernel_.edges_end(); ++e_it) {
-            if(v_status_[kernel_.edge(*e_it).from_vertex().idx()].deleted() ||
-                    v_status_[kernel_.edge(*e_it).to_vertex().idx()].deleted()) {
-                e_status_[e_it->idx()].set_deleted(true);
-            }
-        }
+void StatusAttrib::garbage_collection(HandleRemap& _remap, bool _preserveManifoldness) {
+
+    /*
+     * 1. Delete all entities marked as deleted together with all
+     *    higher-dimensional entities incident to them in one pass
+     *    (see TopologyKernel::delete_tagged()).
+     * 2. If desired, search for all isolated entities, mark them
+     *    deleted and delete them in a second pass in order to
+     *    preserve manifoldness.
+     */
+
+    std::vector<bool> vertexTags(kernel_.n_vertices());
+    for(size_t i = 0; i < vertexTags.size(); ++i) vertexTags[i] = v_status_[i].deleted();
+    std::vector<bool> edgeTags(kernel_.n_edges());
+    for(size_t i = 0; i < edgeTags.size(); ++i) edgeTags[i] = e_status_[i].deleted();
+    std::vector<bool> faceTags(kernel_.n_faces());
+    for(size_t i = 0; i < faceTags.size(); ++i) faceTags[i] = f_status_[i].deleted();
+    std::vector<bool> cellTags(kernel_.n_cells());
+    for(size_t i = 0; i < cellTags.size(); ++i) cellTags[i] = c_status_[i].deleted();
+
+    kernel_.delete_tagged(vertexTags, edgeTags, faceTags, cellTags, &_remap);
+
+    if(!_preserveManifoldness) return;
+
+    if(!kernel_.has_full_bottom_up_incidences()) {
+#ifndef NDEBUG
+        std::cerr << "Preservation of three-manifoldness in garbage_collection() "
+                << "requires bottom-up incidences!" << std::endl;
+#endif
+        return;
     }
 
-    // Faces
-    if(kernel_.has_edge_bottom_up_incidences()) {
+    // Go over all faces and find those
+    // that are not incident to any cell
+    for(FaceIter f_it = kernel_.faces_begin(); f_it != kernel_.faces_end(); ++f_it) {
 
-        for(EdgeIter e_it = kernel_.edges_begin(); e_it != kernel_.edges_end(); ++e_it) {
-            if(e_status_[e_it->idx()].deleted()) {
-                for(HalfEdgeHalfFaceIter hehf_it = kernel_.hehf_iter(kernel_.halfedge_handle(*e_it, 0));
-                        hehf_it.valid(); ++hehf_it) {
-                    f_status_[kernel_.face_handle(*hehf_it).idx()].set_deleted(true);
-                }
-            }
+        // Get half-faces
+        HalfFaceHandle hf0 = kernel_.halfface_handle(*f_it, 0);
+        HalfFaceHandle hf1 = kernel_.halfface_handle(*f_it, 1);
+
+        // If neither of the half-faces is incident to a cell, delete face
+        if(kernel_.incident_cell(hf0) == TopologyKernel::InvalidCellHandle &&
+                kernel_.incident_cell(hf1) == TopologyKernel::InvalidCellHandle) {
+
+            f_status_[f_it->idx()].set_deleted(true);
         }
-    } else {
+    }
+
+    // Go over all edges and find those
+    // whose half-edges are not incident to any half-face
+    for(EdgeIter e_it = kernel_.edges_begin(); e_it != kernel_.edges_end(); ++e_it) {
+
+        // Get half-edges
+        HalfEdgeHandle he = kernel_.halfedge_handle(*e_it, 0);
+
+        // If the half-edge isn't incident to a half-face, delete edge
+        HalfEdgeHalfFaceIter hehf_it = kernel_.hehf_iter(he);
 
-        for(FaceIter f_it = kernel_.faces_begin(); f_it != kernel_.faces_end(); ++f_it) {
+        if(!hehf_it.valid()) {
 
-            const std::vector<HalfEdgeHandle>& hes = kernel_.face(*f_it).halfedges();
-            for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin(),
-                    he_end = hes.end(); he_it != he_end; ++he_it) {
-                if(e_status_[kernel_.edge_handle(*he_it)].deleted()) {
-                    f_status_[*f_it].set_deleted(true);
+            e_status_[e_it->idx()].set_deleted(true);
+
+        } else {
+            bool validFace = false;
+            for(; hehf_it.valid(); ++hehf_it) {
+                if(!f_status_[kernel_.face_handle(*hehf_it).idx()].deleted()) {
+                    validFace = true;
                     break;
                 }
             }
+            if(!validFace) {
+                e_status_[e_it->idx()].set_deleted(true);
+            }
         }
     }
 
-    // Cells
-    if(kernel_.has_face_bottom_up_incidences()) {
+    // Go over all vertices and find those
+    // that are not incident to any edge
+    for(VertexIter v_it = kernel_.vertices_begin(); v_it != kernel_.vertices_end(); ++v_it) {
 
-        for(FaceIter f_it = kernel_.faces_begin(); f_it != kernel_.faces_end(); ++f_it) {
-            if(f_status_[f_it->idx()].deleted()) {
-                CellHandle c0 = kernel_.incident_cell(kernel_.halfface_handle(*f_it, 0));
-                CellHandle c1 = kernel_.incident_cell(kernel_.halfface_handle(*f_it, 1));
-                if(c0.is_valid()) {
-                    c_status_[c0].set_deleted(true);
-                }
-                if(c1.is_valid()) {
-                    c_status_[c1].set_deleted(true);
-                }
-            }
-        }
-    } else {
+        // If neither of the half-edges is incident to a half-face, delete edge
+        VertexOHalfEdgeIter voh_it = kernel_.voh_iter(*v_it);
+
+        if(!voh_it.valid()) {
 
-        for(CellIter c_it = kernel_.cells_begin(); c_it != kernel_.cells_end(); ++c_it) {
+            v_status_[v_it->idx()].set_deleted(true);
+        } else {
 
-            const std::vector<HalfFaceHandle>& hfs = kernel_.cell(*c_it).halffaces();
-            for(std::vector<HalfFaceHandle>::const_iterator hf_it = hfs.begin(),
-                    hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
-                if(f_status_[kernel_.face_handle(*hf_it)].deleted()) {
-                    c_status_[*c_it].set_deleted(true);
+            bool validEdge = false;
+            for(; voh_it.valid(); ++voh_it) {
+                if(!e_status_[kernel_.edge_handle(voh_it->idx())].deleted()) {
+                    validEdge = true;
                     break;
                 }
             }
+            if(!validEdge) {
+                v_status_[v_it->idx()].set_deleted(true);
+            }
         }
     }
-}
-
-//========================================================================================
-
-void StatusAttrib::garbage_collection(bool _preserveManifoldness) {
-    std::vector<VertexHandle*> vh_empty;
-    std::vector<HalfEdgeHandle*> hh_empty;
-    std::vector<HalfFaceHandle*> hfh_empty;
-    std::vector<CellHandle*> ch_empty;
 
-    garbage_collection(vh_empty, hh_empty, hfh_empty, ch_empty, _preserveManifoldness);
+    // Second pass, the handles move once more
+    HandleRemap remap;
+    garbage_collection(remap, false);
+    _remap.concatenate(remap);
 }
 
 
@@ -45,6 +45,7 @@
 
 #include <cassert>
 
+#include "../Core/HandleRemap.hh"
 #include "../Core/OpenVolumeMeshHandle.hh"
 #include "OpenVolumeMeshStatus.hh"
 #include "../Core/PropertyDefines.hh"
@@ -227,6 +228,19 @@ public:
      */
     void garbage_collection(bool _preserveManifoldness = false);
 
+    /**
+     * \brief garbage collection returning the handle remap tables
+     *
+     * Same as garbage_collection(bool), additionally stores the new index
+     * of every vertex, edge, face and cell from before the collection in
+     * _remap (-1 for deleted entities), so that external handle arrays can
+     * be updated in one pass.
+     *
+     * @param _remap Receives the old to new index tables
+     * @param _preserveManifoldness Pass true if the mesh is required to stay three-manifold
+     */
+    void garbage_collection(HandleRemap& _remap, bool _preserveManifoldness = false);
+
     /**
      * \brief garbage collection with handle tracking
      *
@@ -264,8 +278,6 @@ public:
 
 private:
 
-    void mark_higher_dim_entities();
-
     TopologyKernel& kernel_;
 
     VertexPropertyT<OpenVolumeMeshStatus> v_status_;
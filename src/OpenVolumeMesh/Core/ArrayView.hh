@@ -0,0 +1,127 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef ARRAYVIEW_HH_
+#define ARRAYVIEW_HH_
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class ConstArrayView
+ *
+ * Lightweight read-only view on a contiguous range of elements.
+ *
+ * The view does not own the referenced data. It stays valid only as long as
+ * the underlying storage is neither modified nor reallocated, i.e. views
+ * returned by the mesh kernels are invalidated by any topology change.
+ * Use the conversion to std::vector in order to obtain a persistent copy.
+ */
+
+template <class T>
+class ConstArrayView {
+public:
+
+    typedef T           value_type;
+    typedef const T*    const_iterator;
+    typedef const T*    iterator;
+    typedef const T&    const_reference;
+    typedef size_t      size_type;
+
+    ConstArrayView() :
+        begin_(0),
+        size_(0) {
+    }
+
+    ConstArrayView(const T* _begin, size_t _size) :
+        begin_(_begin),
+        size_(_size) {
+    }
+
+    ConstArrayView(const std::vector<T>& _vec) :
+        begin_(_vec.empty() ? 0 : &_vec[0]),
+        size_(_vec.size()) {
+    }
+
+    const_iterator begin() const { return begin_; }
+
+    const_iterator end() const { return begin_ + size_; }
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    const T& operator[](size_t _idx) const {
+        assert(_idx < size_);
+        return begin_[_idx];
+    }
+
+    const T& front() const {
+        assert(size_ > 0);
+        return begin_[0];
+    }
+
+    const T& back() const {
+        assert(size_ > 0);
+        return begin_[size_ - 1];
+    }
+
+    /// Copy the referenced elements into a vector
+    std::vector<T> to_vector() const {
+        return std::vector<T>(begin(), end());
+    }
+
+    operator std::vector<T>() const {
+        return to_vector();
+    }
+
+private:
+    const T* begin_;
+    size_t size_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* ARRAYVIEW_HH_ */
@@ -52,10 +52,11 @@ std::ostream& operator<<(std::ostream& _os, const OpenVolumeMeshEdge& _edge) {
 
 std::ostream& operator<<(std::ostream& _os, const OpenVolumeMeshFace& _face) {
     _os << "(";
-    for(std::vector<HalfEdgeHandle>::const_iterator it =
-            _face.halfedges().begin(); it < _face.halfedges().end(); ++it) {
+    OpenVolumeMeshFace::HalfEdgeView hes = _face.halfedges();
+    for(OpenVolumeMeshFace::HalfEdgeView::const_iterator it =
+            hes.begin(); it < hes.end(); ++it) {
         _os << *it;
-        if(it + 1 < _face.halfedges().end())
+        if(it + 1 < hes.end())
             _os << ", ";
     }
     _os << ")";
@@ -64,10 +65,11 @@ std::ostream& operator<<(std::ostream& _os, const OpenVolumeMeshFace& _face) {
 
 std::ostream& operator<<(std::ostream& _os, const OpenVolumeMeshCell& _cell) {
     _os << "(";
-    for(std::vector<HalfFaceHandle>::const_iterator it =
-            _cell.halffaces().begin(); it < _cell.halffaces().end(); ++it) {
+    OpenVolumeMeshCell::HalfFaceView hfs = _cell.halffaces();
+    for(OpenVolumeMeshCell::HalfFaceView::const_iterator it =
+            hfs.begin(); it < hfs.end(); ++it) {
         _os << *it;
-        if(it + 1 < _cell.halffaces().end())
+        if(it + 1 < hfs.end())
             _os << ", ";
     }
     _os << ")";
@@ -45,7 +45,9 @@
 
 #include <vector>
 
+#include "ArrayView.hh"
 #include "OpenVolumeMeshHandle.hh"
+#include "SmallVector.hh"
 
 namespace OpenVolumeMesh {
 
@@ -90,25 +92,69 @@ std::ostream& operator<<(std::ostream& _os, const OpenVolumeMeshEdge& _edge);
 class OpenVolumeMeshFace {
 friend class TopologyKernel;
 public:
-    OpenVolumeMeshFace(const std::vector<HalfEdgeHandle>& _halfedges) :
-        halfedges_(_halfedges) {
+    typedef ConstArrayView<HalfEdgeHandle> HalfEdgeView;
+
+    OpenVolumeMeshFace(const std::vector<HalfEdgeHandle>& _halfedges) {
+        set_halfedges(_halfedges);
+    }
+
+    OpenVolumeMeshFace(const OpenVolumeMeshFace& _other) :
+        storage_(_other.storage_),
+        halfedges_(_other.owns_halfedges() ? storage_view() : _other.halfedges_) {
     }
 
     virtual ~OpenVolumeMeshFace() {
     }
 
-    const std::vector<HalfEdgeHandle>& halfedges() const {
+    OpenVolumeMeshFace& operator=(const OpenVolumeMeshFace& _other) {
+        if(this != &_other) {
+            storage_ = _other.storage_;
+            halfedges_ = _other.owns_halfedges() ? storage_view() : _other.halfedges_;
+        }
+        return *this;
+    }
+
+    /// The face's halfedges. If this face was obtained via
+    /// TopologyKernel::face(), the view refers to the kernel's
+    /// halfedge array and is invalidated by topology changes.
+    HalfEdgeView halfedges() const {
         return halfedges_;
     }
 
 protected:
 
+    // Create a face that refers to halfedges stored elsewhere
+    OpenVolumeMeshFace(const HalfEdgeHandle* _begin, size_t _size) :
+        halfedges_(_begin, _size) {
+    }
+
     void set_halfedges(const std::vector<HalfEdgeHandle>& _halfedges) {
-        halfedges_ = _halfedges;
+        if(_halfedges.empty()) {
+            set_halfedges(0, 0);
+        } else {
+            set_halfedges(&_halfedges[0], _halfedges.size());
+        }
+    }
+
+    // Copy the halfedges into the face's own storage
+    void set_halfedges(const HalfEdgeHandle* _begin, size_t _size) {
+        storage_.assign(_begin, _begin + _size);
+        halfedges_ = storage_view();
     }
 
 private:
-    std::vector<HalfEdgeHandle> halfedges_;
+
+    bool owns_halfedges() const {
+        return !storage_.empty() && halfedges_.begin() == storage_.begin();
+    }
+
+    HalfEdgeView storage_view() const {
+        return HalfEdgeView(storage_.begin(), storage_.size());
+    }
+
+    // Triangles and quads are stored without heap allocation
+    SmallVector<HalfEdgeHandle, 4> storage_;
+    HalfEdgeView halfedges_;
 };
 
 // Stream operator for faces
@@ -119,25 +165,56 @@ std::ostream& operator<<(std::ostream& _os, const OpenVolumeMeshFace& _face);
 class OpenVolumeMeshCell {
 friend class TopologyKernel;
 public:
+    typedef ConstArrayView<HalfFaceHandle> HalfFaceView;
+
     OpenVolumeMeshCell(const std::vector<HalfFaceHandle>& _halffaces) :
-        halffaces_(_halffaces) {
+        storage_(_halffaces),
+        halffaces_(storage_) {
+    }
+
+    OpenVolumeMeshCell(const OpenVolumeMeshCell& _other) :
+        storage_(_other.storage_),
+        halffaces_(_other.owns_halffaces() ? HalfFaceView(storage_) : _other.halffaces_) {
     }
 
     virtual ~OpenVolumeMeshCell() {
     }
 
-    const std::vector<HalfFaceHandle>& halffaces() const {
+    OpenVolumeMeshCell& operator=(const OpenVolumeMeshCell& _other) {
+        if(this != &_other) {
+            storage_ = _other.storage_;
+            halffaces_ = _other.owns_halffaces() ? HalfFaceView(storage_) : _other.halffaces_;
+        }
+        return *this;
+    }
+
+    /// The cell's halffaces. If this cell was obtained via
+    /// TopologyKernel::cell(), the view refers to the kernel's
+    /// halfface array and is invalidated by topology changes.
+    HalfFaceView halffaces() const {
         return halffaces_;
     }
 
 protected:
 
+    // Create a cell that refers to halffaces stored elsewhere
+    OpenVolumeMeshCell(const HalfFaceHandle* _begin, size_t _size) :
+        halffaces_(_begin, _size) {
+    }
+
     void set_halffaces(const std::vector<HalfFaceHandle>& _halffaces) {
-        halffaces_ = _halffaces;
+        storage_ = _halffaces;
+        halffaces_ = HalfFaceView(storage_);
     }
 
 private:
-    std::vector<HalfFaceHandle> halffaces_;
+
+    bool owns_halffaces() const {
+        return !storage_.empty() && halffaces_.begin() == &storage_[0];
+    }
+
+    std::vector<HalfFaceHandle> storage_;
+    HalfFaceView halffaces_;
 };
 
 // Stream operator for cells
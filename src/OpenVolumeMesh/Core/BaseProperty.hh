@@ -67,6 +67,8 @@ public:
 
     virtual void delete_element(size_t _idx) = 0;
 
+    virtual void reset_element(size_t _idx) = 0;
+
     virtual void swap_elements(size_t _idx0, size_t _idx1) = 0;
 
     virtual void copy(size_t _src_idx, size_t _dst_idx) = 0;
@@ -91,6 +93,8 @@ protected:
 
     virtual void resize(size_t /*_size*/) = 0;
 
+    virtual void reserve(size_t /*_size*/) = 0;
+
     virtual void set_handle(const OpenVolumeMeshHandle& /*_handle*/) = 0;
 
     void lock() { lock_ = true; }
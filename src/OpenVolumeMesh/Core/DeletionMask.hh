@@ -0,0 +1,221 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef DELETIONMASK_HH_
+#define DELETIONMASK_HH_
+
+#include <cassert>
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class DeletionMask
+ *
+ * Packed deletion flags of one entity type.
+ *
+ * In contrast to std::vector<bool>, the mask keeps track of the number
+ * of deleted entries and scans for non-deleted entries a 64 bit word at
+ * a time, so iterating over the remaining entities costs next to nothing
+ * if there are no (or only few) deleted ones.
+ */
+
+class DeletionMask {
+public:
+
+    typedef uint64_t Word;
+
+    DeletionMask() : size_(0), n_deleted_(0) {}
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    /// Number of entries flagged as deleted
+    size_t count() const { return n_deleted_; }
+
+    /// True if no entry is flagged as deleted
+    bool none() const { return n_deleted_ == 0; }
+
+    bool operator[](size_t _i) const {
+        assert(_i < size_);
+        return (words_[_i >> 6] >> (_i & 63u)) & 1u;
+    }
+
+    void set(size_t _i, bool _deleted) {
+        assert(_i < size_);
+        Word& word = words_[_i >> 6];
+        const Word bit = Word(1) << (_i & 63u);
+        if(_deleted && !(word & bit)) {
+            word |= bit;
+            ++n_deleted_;
+        } else if(!_deleted && (word & bit)) {
+            word &= ~bit;
+            --n_deleted_;
+        }
+    }
+
+    void swap(size_t _i, size_t _j) {
+        const bool tmp = (*this)[_i];
+        set(_i, (*this)[_j]);
+        set(_j, tmp);
+    }
+
+    void push_back(bool _deleted) {
+        if((size_ & 63u) == 0u) words_.push_back(0u);
+        ++size_;
+        if(_deleted) set(size_ - 1u, true);
+    }
+
+    void resize(size_t _n, bool _deleted = false) {
+
+        if(_n < size_) {
+            // Forget the flags behind the new end
+            for(size_t i = _n; i < size_ && i < ((_n + 63u) & ~size_t(63u)); ++i) {
+                set(i, false);
+            }
+            for(size_t w = (_n + 63u) >> 6; w < words_.size(); ++w) {
+                n_deleted_ -= popcount(words_[w]);
+            }
+            words_.resize((_n + 63u) >> 6);
+            size_ = _n;
+        } else {
+            const size_t old_size = size_;
+            words_.resize((_n + 63u) >> 6, 0u);
+            size_ = _n;
+            if(_deleted) {
+                for(size_t i = old_size; i < _n; ++i) set(i, true);
+            }
+        }
+    }
+
+    void reserve(size_t _n) { words_.reserve((_n + 63u) >> 6); }
+
+    void clear() {
+        words_.clear();
+        size_ = 0;
+        n_deleted_ = 0;
+    }
+
+    /// Remove the entries [_first, _last), moving the following ones forward
+    void erase(size_t _first, size_t _last) {
+        assert(_first <= _last && _last <= size_);
+        const size_t n = _last - _first;
+        for(size_t i = _last; i < size_; ++i) {
+            set(i - n, (*this)[i]);
+        }
+        resize(size_ - n);
+    }
+
+    void erase(size_t _i) { erase(_i, _i + 1u); }
+
+    /// Remove all entries whose tag is set, keeping the order of the others
+    void erase_tagged(const std::vector<bool>& _tag) {
+        assert(_tag.size() == size_);
+        size_t n = 0;
+        for(size_t i = 0; i < size_; ++i) {
+            if(!_tag[i]) set(n++, (*this)[i]);
+        }
+        resize(n);
+    }
+
+    /// Index of the first entry at or after _i that is not deleted,
+    /// size() if there is none
+    size_t next_alive(size_t _i) const {
+
+        if(_i >= size_) return size_;
+
+        size_t w = _i >> 6;
+        Word alive = ~words_[w] & (~Word(0) << (_i & 63u));
+        while(alive == 0u) {
+            if(++w == words_.size()) return size_;
+            alive = ~words_[w];
+        }
+        // Bits behind size() are never set, so clamp the index
+        const size_t i = (w << 6) + ctz(alive);
+        return i < size_ ? i : size_;
+    }
+
+private:
+
+    static unsigned int popcount(Word _w) {
+#if defined(__GNUC__)
+        return (unsigned int)__builtin_popcountll(_w);
+#else
+        unsigned int n = 0;
+        for(; _w != 0u; _w &= _w - 1u) ++n;
+        return n;
+#endif
+    }
+
+    // Number of trailing zeros, _w must not be zero
+    static unsigned int ctz(Word _w) {
+#if defined(__GNUC__)
+        return (unsigned int)__builtin_ctzll(_w);
+#elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long i;
+        _BitScanForward64(&i, _w);
+        return (unsigned int)i;
+#else
+        unsigned int n = 0;
+        for(; (_w & 1u) == 0u; _w >>= 1) ++n;
+        return n;
+#endif
+    }
+
+    std::vector<Word> words_;
+
+    size_t size_;
+
+    size_t n_deleted_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* DELETIONMASK_HH_ */
@@ -0,0 +1,182 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef ENTITYRANGE_HH_
+#define ENTITYRANGE_HH_
+
+#include <iterator>
+
+#include "DeletionMask.hh"
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class EntityRangeIter
+ *
+ * Lightweight iterator over the non-deleted entities of one type.
+ *
+ * Yields plain handles and skips deleted entities by scanning the
+ * kernel's DeletionMask. Half-entities (halfedges, halffaces) share
+ * the flag of their full entity.
+ */
+
+template <class HandleT>
+class EntityRangeIter {
+public:
+
+    // STL compliance
+    typedef std::forward_iterator_tag   iterator_category;
+    typedef int                         difference_type;
+    typedef const HandleT               value_type;
+    typedef const HandleT*              pointer;
+    typedef const HandleT&              reference;
+
+    EntityRangeIter() : deleted_(0), shift_(0), cur_handle_(-1) {}
+
+    /// _deleted is 0 if there are no deleted entities
+    EntityRangeIter(const DeletionMask* _deleted, unsigned int _shift, int _idx) :
+        deleted_(_deleted), shift_(_shift), cur_handle_(_idx) {
+
+        if(deleted_) skip_deleted();
+    }
+
+    bool operator==(const EntityRangeIter& _c) const { return cur_handle_ == _c.cur_handle_; }
+    bool operator!=(const EntityRangeIter& _c) const { return cur_handle_ != _c.cur_handle_; }
+
+    reference operator*() const { return cur_handle_; }
+
+    pointer operator->() const { return &cur_handle_; }
+
+    EntityRangeIter& operator++() {
+        cur_handle_ = HandleT(cur_handle_.idx() + 1);
+        // The second half-entity is alive if the first one is
+        if(deleted_ && (cur_handle_.idx() & ((1 << shift_) - 1)) == 0) skip_deleted();
+        return *this;
+    }
+
+    EntityRangeIter operator++(int) {
+        EntityRangeIter cpy = *this;
+        ++(*this);
+        return cpy;
+    }
+
+private:
+
+    // Move to the first non-deleted handle at or after the current one
+    void skip_deleted() {
+        const size_t e = (size_t)cur_handle_.idx() >> shift_;
+        const size_t alive = deleted_->next_alive(e);
+        if(alive != e) cur_handle_ = HandleT((int)(alive << shift_));
+    }
+
+    const DeletionMask* deleted_;
+    unsigned int shift_;
+    HandleT cur_handle_;
+};
+
+/**
+ * \class EntityRange
+ *
+ * The non-deleted entities of one type, see e.g.
+ * TopologyKernel::cell_range(). Usable in range-based for loops.
+ *
+ * If no entity is deleted, the range is contiguous and for_each()
+ * runs a plain counted loop over the handles 0..end_index()-1, which
+ * the compiler is free to vectorize.
+ */
+
+template <class HandleT>
+class EntityRange {
+public:
+
+    typedef EntityRangeIter<HandleT> iterator;
+    typedef EntityRangeIter<HandleT> const_iterator;
+
+    /// Halfentities pass _shift = 1, as they share the flags of their entities
+    explicit EntityRange(const DeletionMask& _deleted, unsigned int _shift = 0u) :
+        deleted_(_deleted.none() ? 0 : &_deleted),
+        shift_(_shift),
+        end_index_((int)(_deleted.size() << _shift)),
+        size_((_deleted.size() - _deleted.count()) << _shift) {}
+
+    iterator begin() const { return iterator(deleted_, shift_, 0); }
+
+    iterator end() const { return iterator(0, shift_, end_index_); }
+
+    /// Iterator to the first non-deleted handle with index _idx or larger
+    iterator from(int _idx) const { return iterator(deleted_, shift_, _idx); }
+
+    /// Number of non-deleted entities
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    /// True if there are no deleted entities, i.e. the
+    /// range consists of all handles below end_index()
+    bool contiguous() const { return deleted_ == 0; }
+
+    /// One past the largest handle index
+    int end_index() const { return end_index_; }
+
+    /// Call _f for each handle in the range
+    template <class FuncT>
+    FuncT for_each(FuncT _f) const {
+        if(deleted_ == 0) {
+            for(int i = 0; i < end_index_; ++i) _f(HandleT(i));
+        } else {
+            for(iterator it = begin(); it != end(); ++it) _f(*it);
+        }
+        return _f;
+    }
+
+private:
+
+    const DeletionMask* deleted_;
+    unsigned int shift_;
+    int end_index_;
+    size_t size_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* ENTITYRANGE_HH_ */
@@ -70,11 +70,49 @@ public:
     /// Add a geometric point to the mesh
     VertexHandle add_vertex(const VecT& _p) {
 
-        // Store vertex in list
-        vertices_.push_back(_p);
-
         // Get handle of recently created vertex
-        return KernelT::add_vertex();
+        const VertexHandle vh = KernelT::add_vertex();
+
+        // Store vertex in list, it may have taken the slot of a deleted one
+        if((size_t)vh.idx() < vertices_.size()) {
+            vertices_[vh.idx()] = _p;
+        } else {
+            vertices_.push_back(_p);
+        }
+        return vh;
+    }
+
+    /// Override of empty add_vertices function
+    virtual VertexHandle add_vertices(size_t _n) {
+
+        vertices_.resize(vertices_.size() + _n, VecT());
+        return KernelT::add_vertices(_n);
+    }
+
+    /// Add _n points at once, given by VecT::dim() consecutive coordinates each
+    ///
+    /// \return Handle of the first new vertex
+    VertexHandle add_vertices(const typename VecT::value_type* _coords, size_t _n) {
+
+        const size_t dim = (size_t)VecT::dim();
+
+        vertices_.reserve(vertices_.size() + _n);
+        for(size_t i = 0; i < _n; ++i) {
+            VecT p;
+            for(size_t k = 0; k < dim; ++k) {
+                p[k] = _coords[i * dim + k];
+            }
+            vertices_.push_back(p);
+        }
+
+        return KernelT::add_vertices(_n);
+    }
+
+    /// Reserve memory for the points as well
+    virtual void reserve(size_t _nv, size_t _ne, size_t _nf, size_t _nc) {
+
+        vertices_.reserve(_nv);
+        KernelT::reserve(_nv, _ne, _nf, _nc);
     }
 
     /// Set the coordinates of point _vh
@@ -105,25 +143,6 @@ public:
         return nV;
     }
 
-    virtual void collect_garbage()
-    {
-        if (!TopologyKernelT::needs_garbage_collection())
-            return;
-
-        if (TopologyKernelT::fast_deletion_enabled()) {
-            TopologyKernelT::collect_garbage();
-            vertices_.resize(TopologyKernel::n_vertices());
-        } else {
-            for (int i = (int)vertices_.size(); i > 0; --i)
-                if (TopologyKernelT::is_deleted(VertexHandle(i-1)))
-                {
-                    vertices_.erase(vertices_.begin() + (i-1));
-                }
-            TopologyKernelT::collect_garbage();
-        }
-
-    }
-
     virtual void swap_vertices(VertexHandle _h1, VertexHandle _h2)
     {
         assert(_h1.idx() >= 0 && _h1.idx() < (int)vertices_.size());
@@ -0,0 +1,93 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef HALFFACECORNER_HH_
+#define HALFFACECORNER_HH_
+
+#include "OpenVolumeMeshHandle.hh"
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class HalfFaceCorner
+ *
+ * Position of a halfedge within a halfface: the halfface and the local
+ * index of the halfedge in the halfface's cyclic halfedge order.
+ *
+ * Moving to the next, previous or opposite corner only changes the
+ * index (see TopologyKernel::next_corner() etc.), so walking along a
+ * face does not have to search for the current halfedge in the face.
+ * Corners are invalidated by changes to the halfface's halfedges.
+ */
+
+class HalfFaceCorner {
+public:
+
+    HalfFaceCorner() : index_(0u) {}
+
+    HalfFaceCorner(const HalfFaceHandle& _hfh, unsigned int _index) :
+        hfh_(_hfh), index_(_index) {}
+
+    const HalfFaceHandle& halfface() const { return hfh_; }
+
+    unsigned int index() const { return index_; }
+
+    bool is_valid() const { return hfh_.is_valid(); }
+
+    bool operator==(const HalfFaceCorner& _other) const {
+        return hfh_ == _other.hfh_ && index_ == _other.index_;
+    }
+
+    bool operator!=(const HalfFaceCorner& _other) const {
+        return !(*this == _other);
+    }
+
+private:
+
+    HalfFaceHandle hfh_;
+
+    unsigned int index_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* HALFFACECORNER_HH_ */
@@ -0,0 +1,128 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef HANDLEREMAP_HH_
+#define HANDLEREMAP_HH_
+
+#include <cassert>
+#include <vector>
+
+#include "OpenVolumeMeshHandle.hh"
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class HandleRemap
+ *
+ * Old to new entity indices of a garbage collection (see
+ * TopologyKernel::collect_garbage() and StatusAttrib::garbage_collection()).
+ *
+ * For every vertex, edge, face and cell that existed before the collection,
+ * the tables hold its new index, or -1 if it has been deleted. Halfedge
+ * 2i+k becomes halfedge 2*edges[i]+k, likewise for halffaces. Being plain
+ * arrays, the tables can also be applied to external data directly.
+ */
+
+class HandleRemap {
+public:
+
+    std::vector<int> vertices;
+    std::vector<int> edges;
+    std::vector<int> faces;
+    std::vector<int> cells;
+
+    /// Replace the tables by their composition with _next (applied after this one)
+    void concatenate(const HandleRemap& _next) {
+        concatenate(vertices, _next.vertices);
+        concatenate(edges, _next.edges);
+        concatenate(faces, _next.faces);
+        concatenate(cells, _next.cells);
+    }
+
+    // New handles, invalid handles stay invalid
+
+    VertexHandle operator[](const VertexHandle& _h) const {
+        return VertexHandle(map(vertices, _h.idx()));
+    }
+
+    EdgeHandle operator[](const EdgeHandle& _h) const {
+        return EdgeHandle(map(edges, _h.idx()));
+    }
+
+    HalfEdgeHandle operator[](const HalfEdgeHandle& _h) const {
+        return HalfEdgeHandle(map_half(edges, _h.idx()));
+    }
+
+    FaceHandle operator[](const FaceHandle& _h) const {
+        return FaceHandle(map(faces, _h.idx()));
+    }
+
+    HalfFaceHandle operator[](const HalfFaceHandle& _h) const {
+        return HalfFaceHandle(map_half(faces, _h.idx()));
+    }
+
+    CellHandle operator[](const CellHandle& _h) const {
+        return CellHandle(map(cells, _h.idx()));
+    }
+
+private:
+
+    static int map(const std::vector<int>& _table, int _idx) {
+        assert(_idx < (int)_table.size());
+        return _idx < 0 ? -1 : _table[_idx];
+    }
+
+    static int map_half(const std::vector<int>& _table, int _idx) {
+        const int idx = map(_table, _idx < 0 ? -1 : _idx / 2);
+        return idx < 0 ? -1 : 2 * idx + (_idx & 1);
+    }
+
+    static void concatenate(std::vector<int>& _table, const std::vector<int>& _next) {
+        for(std::vector<int>::iterator it = _table.begin(); it != _table.end(); ++it) {
+            if(*it >= 0) *it = _next[*it];
+        }
+    }
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* HANDLEREMAP_HH_ */
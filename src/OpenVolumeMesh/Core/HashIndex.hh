@@ -0,0 +1,179 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef HASHINDEX_HH_
+#define HASHINDEX_HH_
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class HashIndex
+ *
+ * Open-addressing hash table (linear probing) of entity indices.
+ *
+ * The table only stores the indices together with their hash values.
+ * The keys themselves (e.g. the vertices of an edge) are looked up in the
+ * mesh by the predicate passed to find(), so they never get out of sync
+ * with the actual entities. Inserting and erasing an index requires
+ * the hash value of its key at that point in time.
+ */
+
+class HashIndex {
+public:
+
+    HashIndex() : n_entries_(0), n_tombstones_(0) {}
+
+    size_t size() const { return n_entries_; }
+
+    bool empty() const { return n_entries_ == 0; }
+
+    void clear() {
+        slots_.clear();
+        n_entries_ = 0;
+        n_tombstones_ = 0;
+    }
+
+    /// Make room for _n entries without rehashing
+    void reserve(size_t _n) {
+        if(2u * (_n + 1u) > slots_.size()) rehash(2u * (_n + 1u));
+    }
+
+    void insert(size_t _hash, int _idx) {
+
+        assert(_idx >= 0);
+
+        if(2u * (n_entries_ + n_tombstones_ + 1u) > slots_.size()) {
+            rehash(4u * (n_entries_ + 1u));
+        }
+
+        const size_t mask = slots_.size() - 1u;
+        size_t pos = _hash & mask;
+        while(slots_[pos].idx >= 0) pos = (pos + 1u) & mask;
+
+        if(slots_[pos].idx == Tombstone) --n_tombstones_;
+        slots_[pos].hash = _hash;
+        slots_[pos].idx = _idx;
+        ++n_entries_;
+    }
+
+    /// Remove index _idx that was inserted with hash value _hash
+    bool erase(size_t _hash, int _idx) {
+
+        if(slots_.empty()) return false;
+
+        const size_t mask = slots_.size() - 1u;
+        for(size_t pos = _hash & mask; slots_[pos].idx != Empty; pos = (pos + 1u) & mask) {
+            if(slots_[pos].idx == _idx) {
+                slots_[pos].idx = Tombstone;
+                --n_entries_;
+                ++n_tombstones_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Find the smallest index with hash value _hash
+     * for which _match(index) returns true.
+     *
+     * @return The index or -1 if there is none
+     */
+    template <class Predicate>
+    int find(size_t _hash, const Predicate& _match) const {
+
+        if(slots_.empty()) return -1;
+
+        int result = -1;
+        const size_t mask = slots_.size() - 1u;
+        for(size_t pos = _hash & mask; slots_[pos].idx != Empty; pos = (pos + 1u) & mask) {
+            const Slot& slot = slots_[pos];
+            if(slot.idx >= 0 && slot.hash == _hash &&
+               (result < 0 || slot.idx < result) && _match(slot.idx)) {
+                result = slot.idx;
+            }
+        }
+        return result;
+    }
+
+private:
+
+    // Grow to a power of two of at least _n slots, dropping tombstones
+    void rehash(size_t _n) {
+
+        size_t n_slots = 16u;
+        while(n_slots < _n) n_slots *= 2u;
+
+        std::vector<Slot> old_slots(n_slots);
+        old_slots.swap(slots_);
+        n_entries_ = 0;
+        n_tombstones_ = 0;
+
+        for(std::vector<Slot>::const_iterator it = old_slots.begin(), end = old_slots.end();
+                it != end; ++it) {
+            if(it->idx >= 0) insert(it->hash, it->idx);
+        }
+    }
+
+    static const int Empty = -1;
+    static const int Tombstone = -2;
+
+    struct Slot {
+        Slot() : hash(0), idx(Empty) {}
+        size_t hash;
+        int idx;
+    };
+
+    std::vector<Slot> slots_;
+
+    size_t n_entries_;
+
+    size_t n_tombstones_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* HASHINDEX_HH_ */
@@ -0,0 +1,497 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+#ifndef INCIDENCEARRAY_HH_
+#define INCIDENCEARRAY_HH_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+#include "ArrayView.hh"
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class IncidenceArray
+ *
+ * Stores one variable-length list of handles per entity
+ * (e.g. the outgoing halfedges of each vertex) in a single
+ * contiguous array.
+ *
+ * The array is meant to be built in two passes: First count the number
+ * of entries per list (begin_build(), count(), end_count()), then insert
+ * them (fill()). The result is a tightly packed CSR layout.
+ * build() does both passes for a given generator of entries and
+ * distributes them among several threads if OpenMP is available.
+ *
+ * Incremental updates are supported as well. Each list has a capacity;
+ * if a list has to grow beyond it, it is moved to the end of the array
+ * with twice its capacity and its old slots are left unused.
+ * As soon as more than half of the array is unused it is compacted.
+ */
+
+template <class T>
+class IncidenceArray {
+public:
+
+    /// Mutable reference to one list
+    class Row {
+    public:
+        Row(IncidenceArray* _array, size_t _idx) : array_(_array), idx_(_idx) {}
+
+        T* begin() const { return array_->row_begin(idx_); }
+
+        T* end() const { return array_->row_begin(idx_) + size(); }
+
+        size_t size() const { return array_->sizes_[idx_]; }
+
+        bool empty() const { return size() == 0; }
+
+        T& operator[](size_t _i) const {
+            assert(_i < size());
+            return begin()[_i];
+        }
+
+        void push_back(const T& _value) const { array_->push_back(idx_, _value); }
+
+        void resize(size_t _n) const { array_->resize_row(idx_, _n); }
+
+        void clear() const { array_->sizes_[idx_] = 0; }
+
+        /// Remove the elements in [_first, _last)
+        T* erase(T* _first, T* _last) const {
+            T* new_end = std::copy(_last, end(), _first);
+            resize(new_end - begin());
+            return _first;
+        }
+
+        const Row& operator=(const std::vector<T>& _values) const {
+            array_->assign(idx_, _values);
+            return *this;
+        }
+
+        operator ConstArrayView<T>() const { return ConstArrayView<T>(begin(), size()); }
+
+    private:
+        IncidenceArray* array_;
+        size_t idx_;
+    };
+
+    IncidenceArray() : n_unused_(0) {}
+
+    /// Number of lists
+    size_t size() const { return offsets_.size(); }
+
+    bool empty() const { return offsets_.empty(); }
+
+    void clear() {
+        offsets_.clear();
+        sizes_.clear();
+        capacities_.clear();
+        data_.clear();
+        n_unused_ = 0;
+    }
+
+    /// Resize to _n lists. New lists are empty.
+    void resize(size_t _n) {
+        if(_n < offsets_.size()) {
+            for(size_t i = _n; i < offsets_.size(); ++i) {
+                n_unused_ += capacities_[i];
+            }
+        }
+        offsets_.resize(_n, data_.size());
+        sizes_.resize(_n, 0u);
+        capacities_.resize(_n, 0u);
+    }
+
+    /// Make room for _n_rows lists with _n_entries slots in total
+    void reserve(size_t _n_rows, size_t _n_entries) {
+        offsets_.reserve(_n_rows);
+        sizes_.reserve(_n_rows);
+        capacities_.reserve(_n_rows);
+        data_.reserve(_n_entries);
+    }
+
+    ConstArrayView<T> operator[](size_t _idx) const {
+        assert(_idx < offsets_.size());
+        return ConstArrayView<T>(data_.empty() ? 0 : &data_[0] + offsets_[_idx], sizes_[_idx]);
+    }
+
+    Row operator[](size_t _idx) {
+        assert(_idx < offsets_.size());
+        return Row(this, _idx);
+    }
+
+    /// Remove list _idx, the following lists move down by one
+    void erase_row(size_t _idx) {
+        assert(_idx < offsets_.size());
+        n_unused_ += capacities_[_idx];
+        offsets_.erase(offsets_.begin() + _idx);
+        sizes_.erase(sizes_.begin() + _idx);
+        capacities_.erase(capacities_.begin() + _idx);
+        compact_if_sparse();
+    }
+
+    void swap_rows(size_t _i, size_t _j) {
+        std::swap(offsets_[_i], offsets_[_j]);
+        std::swap(sizes_[_i], sizes_[_j]);
+        std::swap(capacities_[_i], capacities_[_j]);
+    }
+
+    /*
+     * Two-pass construction
+     */
+
+    /// Start building _n empty lists
+    void begin_build(size_t _n) {
+        clear();
+        offsets_.resize(_n, 0u);
+        sizes_.resize(_n, 0u);
+        capacities_.resize(_n, 0u);
+    }
+
+    /// Reserve _n more entries in list _idx (counting pass)
+    void count(size_t _idx, unsigned int _n = 1u) {
+        capacities_[_idx] += _n;
+    }
+
+    /// Compute the list offsets (prefix sum) and allocate storage
+    void end_count() {
+        size_t offset = 0;
+        for(size_t i = 0; i < offsets_.size(); ++i) {
+            offsets_[i] = offset;
+            offset += capacities_[i];
+        }
+        data_.resize(offset);
+    }
+
+    /// Insert an entry into list _idx (filling pass)
+    void fill(size_t _idx, const T& _value) {
+        assert(sizes_[_idx] < capacities_[_idx]);
+        data_[offsets_[_idx] + sizes_[_idx]++] = _value;
+    }
+
+    /**
+     * Build all lists at once. For each item i in [0, _n_items),
+     * _gen(i, sink) is called and has to call sink(list, value)
+     * for every entry that item contributes.
+     *
+     * The items are split into contiguous chunks, one per thread.
+     * Each thread counts its entries per list, the counts are turned
+     * into offsets by a prefix sum and each thread then scatters its entries.
+     * The entries of a list thus appear in the order of the items,
+     * independent of the number of threads.
+     */
+    template <class Generator>
+    void build(size_t _n_rows, size_t _n_items, const Generator& _gen, int _n_threads = 1) {
+
+        begin_build(_n_rows);
+
+#ifdef USE_OPENMP
+        if(_n_threads > 1 && _n_items >= min_items_per_thread * _n_threads) {
+            build_parallel(_n_items, _gen, _n_threads);
+            return;
+        }
+#endif
+
+        Counter counter(capacities_);
+        for(size_t i = 0; i < _n_items; ++i) {
+            _gen(i, counter);
+        }
+        end_count();
+
+        std::vector<unsigned int> cursor(_n_rows, 0u);
+        Scatter scatter(elements_begin(), offsets_, cursor);
+        for(size_t i = 0; i < _n_items; ++i) {
+            _gen(i, scatter);
+        }
+        sizes_ = capacities_;
+    }
+
+    /*
+     * Access to all stored entries (including unused slots),
+     * e.g. for global handle corrections
+     */
+
+    T* elements_begin() { return data_.empty() ? 0 : &data_[0]; }
+
+    T* elements_end() { return elements_begin() + data_.size(); }
+
+    /// Rewrite the lists in order, dropping unused slots and spare capacities
+    void compact() {
+        std::vector<T> new_data;
+        size_t n_used = 0;
+        for(size_t i = 0; i < sizes_.size(); ++i) n_used += sizes_[i];
+        new_data.reserve(n_used);
+
+        for(size_t i = 0; i < offsets_.size(); ++i) {
+            const size_t offset = offsets_[i];
+            offsets_[i] = new_data.size();
+            capacities_[i] = sizes_[i];
+            new_data.insert(new_data.end(), data_.begin() + offset, data_.begin() + offset + sizes_[i]);
+        }
+        data_.swap(new_data);
+        n_unused_ = 0;
+    }
+
+    /**
+     * Remove the lists whose tag is set. Every entry of the other lists is
+     * passed to _filter(T&), which may rewrite it and returns false if the
+     * entry is to be removed. The remaining entries keep their order and
+     * are tightly packed afterwards, as after compact().
+     */
+    template <class Filter>
+    void erase_tagged(const std::vector<bool>& _tag, const Filter& _filter, int _n_threads = 1) {
+
+        assert(_tag.size() == offsets_.size());
+
+        const long n_rows = (long)offsets_.size();
+
+        // Filter each list within its own slots
+#ifdef USE_OPENMP
+        #pragma omp parallel for num_threads(_n_threads) if(n_rows >= (long)min_items_per_thread * _n_threads)
+#else
+        (void)_n_threads;
+#endif
+        for(long r = 0; r < n_rows; ++r) {
+            if(_tag[r]) continue;
+            T* first = row_begin(r);
+            T* out = first;
+            for(T* it = first, *end = first + sizes_[r]; it != end; ++it) {
+                T value = *it;
+                if(_filter(value)) *out++ = value;
+            }
+            sizes_[r] = (unsigned int)(out - first);
+        }
+
+        std::vector<size_t> old_offsets;
+        std::vector<size_t> new_offsets;
+        std::vector<unsigned int> new_sizes;
+        size_t n_entries = 0;
+        for(long r = 0; r < n_rows; ++r) {
+            if(_tag[r]) continue;
+            old_offsets.push_back(offsets_[r]);
+            new_offsets.push_back(n_entries);
+            new_sizes.push_back(sizes_[r]);
+            n_entries += sizes_[r];
+        }
+
+        std::vector<T> new_data(n_entries);
+        const long n_kept = (long)new_offsets.size();
+#ifdef USE_OPENMP
+        #pragma omp parallel for num_threads(_n_threads) if(n_kept >= (long)min_items_per_thread * _n_threads)
+#endif
+        for(long r = 0; r < n_kept; ++r) {
+            std::copy(data_.begin() + old_offsets[r], data_.begin() + old_offsets[r] + new_sizes[r],
+                      new_data.begin() + new_offsets[r]);
+        }
+
+        offsets_.swap(new_offsets);
+        sizes_.swap(new_sizes);
+        capacities_ = sizes_;
+        data_.swap(new_data);
+        n_unused_ = 0;
+    }
+
+private:
+
+    // Counts the entries per list
+    class Counter {
+    public:
+        explicit Counter(std::vector<unsigned int>& _counts) : counts_(_counts) {}
+
+        void operator()(size_t _row, const T&) { ++counts_[_row]; }
+
+    private:
+        std::vector<unsigned int>& counts_;
+    };
+
+    // Writes entries to consecutive slots, starting at _offsets[row] + _cursor[row]
+    class Scatter {
+    public:
+        Scatter(T* _data, const std::vector<size_t>& _offsets, std::vector<unsigned int>& _cursor) :
+            data_(_data), offsets_(_offsets), cursor_(_cursor) {}
+
+        void operator()(size_t _row, const T& _value) {
+            data_[offsets_[_row] + cursor_[_row]++] = _value;
+        }
+
+    private:
+        T* data_;
+        const std::vector<size_t>& offsets_;
+        std::vector<unsigned int>& cursor_;
+    };
+
+    // Below this number of items per thread build() runs serially
+    static const size_t min_items_per_thread = 4096u;
+
+#ifdef USE_OPENMP
+    template <class Generator>
+    void build_parallel(size_t _n_items, const Generator& _gen, int _n_threads) {
+
+        const long n_rows = (long)offsets_.size();
+
+        // Entries per list and thread, later the start of each thread's entries within a list
+        std::vector<std::vector<unsigned int> > cursors(_n_threads);
+
+        #pragma omp parallel num_threads(_n_threads)
+        {
+            // The runtime may provide fewer threads than requested
+            const int n_threads = omp_get_num_threads();
+            const int t = omp_get_thread_num();
+            const size_t first = _n_items * t / n_threads;
+            const size_t last  = _n_items * (t + 1) / n_threads;
+
+            std::vector<unsigned int>& cursor = cursors[t];
+            cursor.assign(n_rows, 0u);
+
+            Counter counter(cursor);
+            for(size_t i = first; i < last; ++i) {
+                _gen(i, counter);
+            }
+
+            #pragma omp barrier
+
+            #pragma omp for
+            for(long r = 0; r < n_rows; ++r) {
+                unsigned int sum = 0u;
+                for(int s = 0; s < n_threads; ++s) {
+                    const unsigned int c = cursors[s][r];
+                    cursors[s][r] = sum;
+                    sum += c;
+                }
+                capacities_[r] = sum;
+            }
+
+            #pragma omp single
+            end_count();
+
+            Scatter scatter(elements_begin(), offsets_, cursor);
+            for(size_t i = first; i < last; ++i) {
+                _gen(i, scatter);
+            }
+        }
+
+        sizes_ = capacities_;
+    }
+#endif
+
+    T* row_begin(size_t _idx) {
+        return data_.empty() ? 0 : &data_[0] + offsets_[_idx];
+    }
+
+    /// Make room for at least _n entries in list _idx
+    void grow(size_t _idx, size_t _n) {
+
+        if(_n <= capacities_[_idx]) return;
+
+        size_t new_capacity = std::max<size_t>(_n, 2u * capacities_[_idx]);
+        if(new_capacity < 4u) new_capacity = 4u;
+
+        if(offsets_[_idx] + capacities_[_idx] == data_.size()) {
+            // Last list in the array, grow in place
+            data_.resize(offsets_[_idx] + new_capacity);
+        } else {
+            // Move list to the end of the array
+            const size_t offset = data_.size();
+            data_.resize(offset + new_capacity);
+            std::copy(data_.begin() + offsets_[_idx],
+                      data_.begin() + offsets_[_idx] + sizes_[_idx],
+                      data_.begin() + offset);
+            n_unused_ += capacities_[_idx];
+            offsets_[_idx] = offset;
+        }
+        capacities_[_idx] = (unsigned int)new_capacity;
+    }
+
+    void push_back(size_t _idx, const T& _value) {
+        grow(_idx, sizes_[_idx] + 1u);
+        data_[offsets_[_idx] + sizes_[_idx]++] = _value;
+        compact_if_sparse();
+    }
+
+    void resize_row(size_t _idx, size_t _n) {
+        if(_n > sizes_[_idx]) {
+            grow(_idx, _n);
+            std::fill(data_.begin() + offsets_[_idx] + sizes_[_idx],
+                      data_.begin() + offsets_[_idx] + _n, T());
+        }
+        sizes_[_idx] = (unsigned int)_n;
+        compact_if_sparse();
+    }
+
+    void assign(size_t _idx, const std::vector<T>& _values) {
+        grow(_idx, _values.size());
+        std::copy(_values.begin(), _values.end(), data_.begin() + offsets_[_idx]);
+        sizes_[_idx] = (unsigned int)_values.size();
+        compact_if_sparse();
+    }
+
+    void compact_if_sparse() {
+        if(n_unused_ > data_.size() / 2u) compact();
+    }
+
+    // Offset of each list's first entry in data_
+    std::vector<size_t> offsets_;
+
+    // Number of entries per list
+    std::vector<unsigned int> sizes_;
+
+    // Number of slots reserved for each list
+    std::vector<unsigned int> capacities_;
+
+    // Entries of all lists
+    std::vector<T> data_;
+
+    // Number of slots in data_ not reserved by any list
+    size_t n_unused_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* INCIDENCEARRAY_HH_ */
@@ -298,24 +298,20 @@ BaseIter(_mesh, _ref_h, _max_laps) {
     }
 
     // Build up face list
-    const std::vector<HalfEdgeHandle>& incidentHalfedges = BaseIter::mesh()->outgoing_hes_per_vertex_[_ref_h.idx()];
-    for(std::vector<HalfEdgeHandle>::const_iterator it = incidentHalfedges.begin(); it != incidentHalfedges.end(); ++it) {
+    ConstArrayView<HalfEdgeHandle> incidentHalfedges = BaseIter::mesh()->outgoing_hes_per_vertex_[_ref_h.idx()];
+    for(ConstArrayView<HalfEdgeHandle>::const_iterator it = incidentHalfedges.begin(); it != incidentHalfedges.end(); ++it) {
 
         if(*it < 0 || (unsigned int)it->idx() >= BaseIter::mesh()->incident_hfs_per_he_.size()) continue;
-            const std::vector<HalfFaceHandle>& incidentHalfFaces = BaseIter::mesh()->incident_hfs_per_he_[it->idx()];
+            ConstArrayView<HalfFaceHandle> incidentHalfFaces = BaseIter::mesh()->incident_hfs_per_he_[it->idx()];
 
-        for (std::vector<HalfFaceHandle>::const_iterator hf_it = incidentHalfFaces.begin();
+        // Every face is reached via both of its halffaces,
+        // it suffices to collect the first ones
+        for (ConstArrayView<HalfFaceHandle>::const_iterator hf_it = incidentHalfFaces.begin();
                 hf_it != incidentHalfFaces.end(); ++hf_it) {
-            faces_.push_back(BaseIter::mesh()->face_handle(*hf_it));
+            if(hf_it->idx() >= 0 && hf_it->idx() % 2 == 0)
+                faces_.insert_sorted_unique(BaseIter::mesh()->face_handle(*hf_it));
         }
     }
-    // Remove all duplicate entries
-    std::sort(faces_.begin(), faces_.end());
-    faces_.resize(std::unique(faces_.begin(), faces_.end()) - faces_.begin());
-
-    // Remove invalid handles
-    if ((faces_.size() > 0) && !faces_.front().is_valid())
-        faces_.erase(faces_.begin());
 
     cur_index_ = 0;
     BaseIter::valid(faces_.size() > 0);
@@ -363,6 +359,24 @@ VertexCellIter::VertexCellIter(const VertexHandle& _ref_h,
         const TopologyKernel* _mesh, int _max_laps) :
 BaseIter(_mesh, _ref_h, _max_laps) {
 
+    if(_mesh->has_vertex_cell_incidences()) {
+
+        // Read the cells from the vertex-cell incidences
+        if((unsigned int)_ref_h.idx() < _mesh->n_vertices()) {
+            ConstArrayView<CellHandle> cells = _mesh->incident_cells(_ref_h);
+            for(ConstArrayView<CellHandle>::const_iterator it = cells.begin(); it != cells.end(); ++it) {
+                cells_.insert_sorted_unique(*it);
+            }
+        }
+
+        cur_index_ = 0;
+        BaseIter::valid(cells_.size()>0);
+        if(BaseIter::valid()) {
+            BaseIter::cur_handle(cells_[cur_index_]);
+        }
+        return;
+    }
+
 	if(!_mesh->has_full_bottom_up_incidences()) {
 #ifndef NDEBUG
         std::cerr << "This iterator needs bottom-up incidences!" << std::endl;
@@ -377,28 +391,21 @@ BaseIter(_mesh, _ref_h, _max_laps) {
     }
 
     // Build up cell list
-    const std::vector<HalfEdgeHandle>& incidentHalfedges = BaseIter::mesh()->outgoing_hes_per_vertex_[_ref_h.idx()];
-    for(std::vector<HalfEdgeHandle>::const_iterator it = incidentHalfedges.begin(); it != incidentHalfedges.end(); ++it) {
+    ConstArrayView<HalfEdgeHandle> incidentHalfedges = BaseIter::mesh()->outgoing_hes_per_vertex_[_ref_h.idx()];
+    for(ConstArrayView<HalfEdgeHandle>::const_iterator it = incidentHalfedges.begin(); it != incidentHalfedges.end(); ++it) {
 
     	if(*it < 0 || (unsigned int)it->idx() >= BaseIter::mesh()->incident_hfs_per_he_.size()) continue;
-        const std::vector<HalfFaceHandle>& incidentHalfFaces = BaseIter::mesh()->incident_hfs_per_he_[it->idx()];
+        ConstArrayView<HalfFaceHandle> incidentHalfFaces = BaseIter::mesh()->incident_hfs_per_he_[it->idx()];
 
-    	for(std::vector<HalfFaceHandle>::const_iterator hf_it = incidentHalfFaces.begin();
+    	for(ConstArrayView<HalfFaceHandle>::const_iterator hf_it = incidentHalfFaces.begin();
                 hf_it != incidentHalfFaces.end(); ++hf_it) {
     		if((unsigned int)hf_it->idx() < BaseIter::mesh()->incident_cell_per_hf_.size()) {
     			CellHandle c_idx = BaseIter::mesh()->incident_cell_per_hf_[hf_it->idx()];
     			if(c_idx != TopologyKernel::InvalidCellHandle)
-                    cells_.push_back(c_idx);
+                    cells_.insert_sorted_unique(c_idx);
     		}
     	}
     }
-    // Remove all duplicate entries
-    std::sort(cells_.begin(), cells_.end());
-    cells_.resize(std::unique(cells_.begin(), cells_.end()) - cells_.begin());
-
-    // Remove invalid handles
-    if ((cells_.size() > 0) && !cells_.front().is_valid())
-        cells_.erase(cells_.begin());
 
     cur_index_ = 0;
     BaseIter::valid(cells_.size()>0);
@@ -474,7 +481,7 @@ cur_index_(0) {
     }
 
     // collect cell handles
-    const std::vector<HalfFaceHandle>& incidentHalffaces = BaseIter::mesh()->incident_hfs_per_he_[_ref_h.idx()];
+    ConstArrayView<HalfFaceHandle> incidentHalffaces = BaseIter::mesh()->incident_hfs_per_he_[_ref_h.idx()];
     std::set<CellHandle> cells;
     for (unsigned int i = 0; i < incidentHalffaces.size(); ++i)
     {
@@ -529,7 +536,7 @@ HalfEdgeCellIter& HalfEdgeCellIter::operator++() {
 
 CellHandle HalfEdgeCellIter::getCellHandle(int _cur_index) const
 {
-    const std::vector<HalfFaceHandle>& halffacehandles = BaseIter::mesh()->incident_hfs_per_he_[BaseIter::ref_handle().idx()];
+    ConstArrayView<HalfFaceHandle> halffacehandles = BaseIter::mesh()->incident_hfs_per_he_[BaseIter::ref_handle().idx()];
     HalfFaceHandle currentHalfface = halffacehandles[_cur_index];
     if(!currentHalfface.is_valid()) return CellHandle(-1);
     CellHandle cellhandle = BaseIter::mesh()->incident_cell_per_hf_[currentHalfface.idx()];
@@ -547,19 +554,17 @@ CellVertexIter::CellVertexIter(const CellHandle& _ref_h,
 BaseIter(_mesh, _ref_h, _max_laps) {
 
     OpenVolumeMeshCell c = BaseIter::mesh()->cell(_ref_h);
-    std::vector<HalfFaceHandle>::const_iterator hf_iter = c.halffaces().begin();
+    OpenVolumeMeshCell::HalfFaceView::const_iterator hf_iter = c.halffaces().begin();
     for(; hf_iter != c.halffaces().end(); ++hf_iter) {
-        const OpenVolumeMeshFace& halfface = BaseIter::mesh()->halfface(*hf_iter);
-        const std::vector<HalfEdgeHandle>& hes = halfface.halfedges();
-        for(std::vector<HalfEdgeHandle>::const_iterator he_iter = hes.begin(); he_iter != hes.end(); ++he_iter) {
-            incident_vertices_.push_back(BaseIter::mesh()->halfedge(*he_iter).to_vertex());
+        // Both halffaces have the same vertices, so use the face's
+        // halfedges rather than building up the opposite halfface
+        const OpenVolumeMeshFace face = BaseIter::mesh()->face(BaseIter::mesh()->face_handle(*hf_iter));
+        const OpenVolumeMeshFace::HalfEdgeView hes = face.halfedges();
+        for(OpenVolumeMeshFace::HalfEdgeView::const_iterator he_iter = hes.begin(); he_iter != hes.end(); ++he_iter) {
+            incident_vertices_.insert_sorted_unique(BaseIter::mesh()->halfedge(*he_iter).to_vertex());
         }
     }
 
-    // Remove all duplicate entries
-    std::sort(incident_vertices_.begin(), incident_vertices_.end());
-    incident_vertices_.resize(std::unique(incident_vertices_.begin(), incident_vertices_.end()) - incident_vertices_.begin());
-
     cur_index_ = 0;
     BaseIter::valid(incident_vertices_.size() > 0);
 
@@ -617,20 +622,25 @@ BaseIter(_mesh, _ref_h, _max_laps) {
         return;
     }
 
-	std::vector<HalfFaceHandle>::const_iterator hf_iter = BaseIter::mesh()->cell(_ref_h).halffaces().begin();
-    std::vector<HalfFaceHandle>::const_iterator hf_end  = BaseIter::mesh()->cell(_ref_h).halffaces().end();
-    for(; hf_iter != hf_end; ++hf_iter) {
-
-		HalfFaceHandle opp_hf = BaseIter::mesh()->opposite_halfface_handle(*hf_iter);
-		CellHandle ch = BaseIter::mesh()->incident_cell_per_hf_[opp_hf.idx()];
-		if(ch != TopologyKernel::InvalidCellHandle) {
-            adjacent_cells_.push_back(ch);
-		}
-	}
-
-    // Remove all duplicate entries
-    std::sort(adjacent_cells_.begin(), adjacent_cells_.end());
-    adjacent_cells_.resize(std::unique(adjacent_cells_.begin(), adjacent_cells_.end()) - adjacent_cells_.begin());
+    if(_mesh->has_cell_neighbor_table()) {
+        const int* neighbors = _mesh->cell_neighbor_table() + (size_t)_ref_h.idx() * _mesh->fixed_cell_valence_;
+        for(unsigned int i = 0; i < _mesh->fixed_cell_valence_; ++i) {
+            if(neighbors[i] >= 0) {
+                adjacent_cells_.insert_sorted_unique(CellHandle(neighbors[i]));
+            }
+        }
+    } else {
+        OpenVolumeMeshCell::HalfFaceView::const_iterator hf_iter = BaseIter::mesh()->cell(_ref_h).halffaces().begin();
+        OpenVolumeMeshCell::HalfFaceView::const_iterator hf_end  = BaseIter::mesh()->cell(_ref_h).halffaces().end();
+        for(; hf_iter != hf_end; ++hf_iter) {
+
+            HalfFaceHandle opp_hf = BaseIter::mesh()->opposite_halfface_handle(*hf_iter);
+            CellHandle ch = BaseIter::mesh()->incident_cell_per_hf_[opp_hf.idx()];
+            if(ch != TopologyKernel::InvalidCellHandle) {
+                adjacent_cells_.insert_sorted_unique(ch);
+            }
+        }
+    }
 
     cur_index_ = 0;
     BaseIter::valid(adjacent_cells_.size()>0);
@@ -683,8 +693,8 @@ BaseIter(_mesh, _ref_h, _max_laps) {
     if(!_ref_h.is_valid()) return;
 
     const OpenVolumeMeshFace& halfface = _mesh->halfface(_ref_h);
-    const std::vector<HalfEdgeHandle>& hes = halfface.halfedges();
-    for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin();
+    const OpenVolumeMeshFace::HalfEdgeView hes = halfface.halfedges();
+    for(OpenVolumeMeshFace::HalfEdgeView::const_iterator he_it = hes.begin();
             he_it != hes.end(); ++he_it) {
         vertices_.push_back(_mesh->halfedge(*he_it).from_vertex());
     }
@@ -748,8 +758,8 @@ BaseIter(_mesh, _ref_h, _max_laps) {
     // Go over all incident halfedges
 //    const std::vector<HalfEdgeHandle> halfedges = _mesh->halfface(_ref_h).halfedges();
     const OpenVolumeMeshFace& halfface = _mesh->halfface(_ref_h);
-    const std::vector<HalfEdgeHandle>& halfedges = halfface.halfedges();
-    for(std::vector<HalfEdgeHandle>::const_iterator he_it = halfedges.begin();
+    const OpenVolumeMeshFace::HalfEdgeView halfedges = halfface.halfedges();
+    for(OpenVolumeMeshFace::HalfEdgeView::const_iterator he_it = halfedges.begin();
             he_it != halfedges.end(); ++he_it) {
 
         // Get outside halffaces
@@ -811,7 +821,8 @@ BoundaryHalfFaceHalfFaceIter& BoundaryHalfFaceHalfFaceIter::operator++() {
 
 BoundaryFaceIter::BoundaryFaceIter(const TopologyKernel* _mesh) :
 BaseIter(_mesh),
-bf_it_(_mesh->faces_begin()) {
+bf_it_(_mesh->faces_begin()),
+list_pos_(-1) {
 
 	if(!_mesh->has_face_bottom_up_incidences()) {
 #ifndef NDEBUG
@@ -821,9 +832,18 @@ bf_it_(_mesh->faces_begin()) {
         return;
     }
 
+	if(_mesh->has_boundary_index()) {
+	    list_pos_ = 0;
+	    BaseIter::valid(!_mesh->boundary_faces().empty());
+	    if(BaseIter::valid()) {
+	        BaseIter::cur_handle(_mesh->boundary_faces()[0]);
+	    }
+	    return;
+	}
+
 	while(bf_it_ != BaseIter::mesh()->faces_end() &&
-            !BaseIter::mesh()->is_boundary(*bf_it_) &&
-            BaseIter::mesh()->is_deleted(bf_it_.cur_handle())){
+            (!BaseIter::mesh()->is_boundary(*bf_it_) ||
+            BaseIter::mesh()->is_deleted(bf_it_.cur_handle()))){
 	    ++bf_it_;
 	}
 	BaseIter::valid(bf_it_ != BaseIter::mesh()->faces_end());
@@ -835,10 +855,20 @@ bf_it_(_mesh->faces_begin()) {
 
 BoundaryFaceIter& BoundaryFaceIter::operator--() {
 
+    if(list_pos_ >= 0) {
+        if(list_pos_ > 0) {
+            --list_pos_;
+            BaseIter::cur_handle(BaseIter::mesh()->boundary_faces()[list_pos_]);
+        } else {
+            BaseIter::valid(false);
+        }
+        return *this;
+    }
+
     --bf_it_;
     while(bf_it_ >= BaseIter::mesh()->faces_begin() &&
-            !BaseIter::mesh()->is_boundary(*bf_it_) &&
-            BaseIter::mesh()->is_deleted(bf_it_.cur_handle())){
+            (!BaseIter::mesh()->is_boundary(*bf_it_) ||
+            BaseIter::mesh()->is_deleted(bf_it_.cur_handle()))){
         --bf_it_;
     }
 	if(bf_it_ >= BaseIter::mesh()->faces_begin()) {
@@ -852,10 +882,21 @@ BoundaryFaceIter& BoundaryFaceIter::operator--() {
 
 BoundaryFaceIter& BoundaryFaceIter::operator++() {
 
+    if(list_pos_ >= 0) {
+        const std::vector<FaceHandle>& faces = BaseIter::mesh()->boundary_faces();
+        if((size_t)list_pos_ + 1 < faces.size()) {
+            ++list_pos_;
+            BaseIter::cur_handle(faces[list_pos_]);
+        } else {
+            BaseIter::valid(false);
+        }
+        return *this;
+    }
+
 	++bf_it_;
 	while(bf_it_ != BaseIter::mesh()->faces_end() &&
-            !BaseIter::mesh()->is_boundary(*bf_it_) &&
-            BaseIter::mesh()->is_deleted(bf_it_.cur_handle())){
+            (!BaseIter::mesh()->is_boundary(*bf_it_) ||
+            BaseIter::mesh()->is_deleted(bf_it_.cur_handle()))){
         ++bf_it_;
     }
 	if(bf_it_ != BaseIter::mesh()->faces_end()) {
@@ -1004,9 +1045,9 @@ FaceIter::FaceIter(const TopologyKernel* _mesh, const FaceHandle& _fh) :
 BaseIter(_mesh, _fh),
 cur_index_(_fh.idx()) {
 
-    while ((unsigned int)cur_index_ < BaseIter::mesh()->faces_.size() && BaseIter::mesh()->is_deleted(FaceHandle(cur_index_)))
+    while ((unsigned int)cur_index_ < BaseIter::mesh()->face_offsets_.size() && BaseIter::mesh()->is_deleted(FaceHandle(cur_index_)))
         ++cur_index_;
-    if((unsigned int)cur_index_ >= BaseIter::mesh()->faces_.size()) {
+    if((unsigned int)cur_index_ >= BaseIter::mesh()->face_offsets_.size()) {
         BaseIter::valid(false);
     }
     BaseIter::cur_handle(FaceHandle(cur_index_));
@@ -1029,9 +1070,9 @@ FaceIter& FaceIter::operator--() {
 FaceIter& FaceIter::operator++() {
 
     ++cur_index_;
-    while ((unsigned int)cur_index_ < BaseIter::mesh()->faces_.size() && BaseIter::mesh()->is_deleted(FaceHandle(cur_index_)))
+    while ((unsigned int)cur_index_ < BaseIter::mesh()->face_offsets_.size() && BaseIter::mesh()->is_deleted(FaceHandle(cur_index_)))
         ++cur_index_;
-    if((unsigned int)cur_index_ >= BaseIter::mesh()->faces_.size()) {
+    if((unsigned int)cur_index_ >= BaseIter::mesh()->face_offsets_.size()) {
         BaseIter::valid(false);
     }
     BaseIter::cur_handle(FaceHandle(cur_index_));
@@ -1047,9 +1088,9 @@ HalfFaceIter::HalfFaceIter(const TopologyKernel* _mesh, const HalfFaceHandle& _h
 BaseIter(_mesh, _hfh),
 cur_index_(_hfh.idx()) {
 
-    while ((unsigned int)cur_index_ < BaseIter::mesh()->faces_.size() * 2 && BaseIter::mesh()->is_deleted(HalfFaceHandle(cur_index_)))
+    while ((unsigned int)cur_index_ < BaseIter::mesh()->face_offsets_.size() * 2 && BaseIter::mesh()->is_deleted(HalfFaceHandle(cur_index_)))
         ++cur_index_;
-    if((unsigned int)cur_index_ >= BaseIter::mesh()->faces_.size() * 2) {
+    if((unsigned int)cur_index_ >= BaseIter::mesh()->face_offsets_.size() * 2) {
         BaseIter::valid(false);
     }
     BaseIter::cur_handle(HalfFaceHandle(cur_index_));
@@ -1072,9 +1113,9 @@ HalfFaceIter& HalfFaceIter::operator--() {
 HalfFaceIter& HalfFaceIter::operator++() {
 
     ++cur_index_;
-    while ((unsigned int)cur_index_ < BaseIter::mesh()->faces_.size() * 2 && BaseIter::mesh()->is_deleted(HalfFaceHandle(cur_index_)))
+    while ((unsigned int)cur_index_ < BaseIter::mesh()->face_offsets_.size() * 2 && BaseIter::mesh()->is_deleted(HalfFaceHandle(cur_index_)))
         ++cur_index_;
-    if((unsigned int)cur_index_ >= BaseIter::mesh()->faces_.size() * 2) {
+    if((unsigned int)cur_index_ >= BaseIter::mesh()->face_offsets_.size() * 2) {
         BaseIter::valid(false);
     }
     BaseIter::cur_handle(HalfFaceHandle(cur_index_));
@@ -1090,9 +1131,9 @@ CellIter::CellIter(const TopologyKernel* _mesh, const CellHandle& _ch) :
 BaseIter(_mesh, _ch),
 cur_index_(_ch.idx()) {
 
-    while ((unsigned int)cur_index_ < BaseIter::mesh()->cells_.size() && BaseIter::mesh()->is_deleted(CellHandle(cur_index_)))
+    while ((unsigned int)cur_index_ < BaseIter::mesh()->n_cells() && BaseIter::mesh()->is_deleted(CellHandle(cur_index_)))
         ++cur_index_;
-    if((unsigned int)cur_index_ >= BaseIter::mesh()->cells_.size()) {
+    if((unsigned int)cur_index_ >= BaseIter::mesh()->n_cells()) {
         BaseIter::valid(false);
     }
     BaseIter::cur_handle(CellHandle(cur_index_));
@@ -1115,9 +1156,9 @@ CellIter& CellIter::operator--() {
 CellIter& CellIter::operator++() {
 
     ++cur_index_;
-    while ((unsigned int)cur_index_ < BaseIter::mesh()->cells_.size() && BaseIter::mesh()->is_deleted(CellHandle(cur_index_)))
+    while ((unsigned int)cur_index_ < BaseIter::mesh()->n_cells() && BaseIter::mesh()->is_deleted(CellHandle(cur_index_)))
         ++cur_index_;
-    if((unsigned int)cur_index_ >= BaseIter::mesh()->cells_.size()) {
+    if((unsigned int)cur_index_ >= BaseIter::mesh()->n_cells()) {
         BaseIter::valid(false);
     }
     BaseIter::cur_handle(CellHandle(cur_index_));
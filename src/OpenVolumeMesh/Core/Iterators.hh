@@ -48,6 +48,7 @@
 #include <vector>
 
 #include "OpenVolumeMeshHandle.hh"
+#include "SmallVector.hh"
 
 namespace OpenVolumeMesh {
 
@@ -472,7 +473,7 @@ public:
   VertexFaceIter& operator--();
 
 private:
-    std::vector<FaceHandle> faces_;
+    SmallVector<FaceHandle, 64> faces_;
     size_t cur_index_;
 };
 
@@ -530,7 +531,7 @@ public:
 	VertexCellIter& operator--();
 
 private:
-    std::vector<CellHandle> cells_;
+    SmallVector<CellHandle, 64> cells_;
     size_t cur_index_;
 };
 
@@ -648,7 +649,7 @@ public:
 	CellVertexIter& operator--();
 
 private:
-	std::vector<VertexHandle> incident_vertices_;
+	SmallVector<VertexHandle, 16> incident_vertices_;
     size_t cur_index_;
 };
 
@@ -706,7 +707,7 @@ public:
 	CellCellIter& operator--();
 
 private:
-    std::vector<CellHandle> adjacent_cells_;
+    SmallVector<CellHandle, 16> adjacent_cells_;
     size_t cur_index_;
 };
 
@@ -1154,6 +1155,12 @@ private:
 
 //===========================================================================
 
+/**
+ * Iterates over all boundary faces. If the mesh maintains a boundary
+ * index (see TopologyKernel::enable_boundary_index()), only the boundary
+ * faces are visited, in unspecified order. Otherwise all faces are
+ * scanned in the order of their handles.
+ */
 class BoundaryFaceIter : public BaseIterator<FaceHandle> {
 public:
     typedef BaseIterator<FaceHandle> BaseIter;
@@ -1204,6 +1211,10 @@ public:
 
 private:
     FaceIter bf_it_;
+
+    // Position in the mesh's list of boundary faces if it has
+    // a boundary index (faces are visited in list order then), -1 otherwise
+    int list_pos_;
 };
 
 //===========================================================================
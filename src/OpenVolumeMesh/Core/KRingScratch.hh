@@ -0,0 +1,108 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef KRINGSCRATCH_HH_
+#define KRINGSCRATCH_HH_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class KRingScratch
+ *
+ * Reusable working memory for TopologyKernel::vertex_k_ring() and
+ * TopologyKernel::cell_k_ring().
+ *
+ * Entities are marked as visited by storing the number of the current
+ * query (its generation) instead of a flag, so starting a new query
+ * does not have to reset anything. Once the buffers have grown to the
+ * size of the mesh, queries do not allocate memory.
+ *
+ * A scratch object must not be shared between threads; use one per thread.
+ */
+
+class KRingScratch {
+public:
+
+    KRingScratch() : generation_(0u) {}
+
+    /// Start a new query on entities with indices below _n
+    void begin(size_t _n) {
+
+        if(stamps_.size() < _n) stamps_.resize(_n, 0u);
+
+        if(++generation_ == 0u) {
+            // The counter wrapped around, old stamps could match again
+            std::fill(stamps_.begin(), stamps_.end(), 0u);
+            generation_ = 1u;
+        }
+    }
+
+    /// Mark entity _idx as visited, returns false if it already was
+    bool visit(int _idx) {
+        assert(_idx >= 0 && (size_t)_idx < stamps_.size());
+        if(stamps_[_idx] == generation_) return false;
+        stamps_[_idx] = generation_;
+        return true;
+    }
+
+    bool visited(int _idx) const {
+        assert(_idx >= 0 && (size_t)_idx < stamps_.size());
+        return stamps_[_idx] == generation_;
+    }
+
+private:
+
+    // Generation of the query that last visited each entity
+    std::vector<unsigned int> stamps_;
+
+    unsigned int generation_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* KRINGSCRATCH_HH_ */
@@ -101,6 +101,9 @@ public:
 	/// Erase an element of the vector
 	virtual void delete_element(size_t _idx) = 0;
 
+	/// Set an element back to the default value
+	virtual void reset(size_t _idx) = 0;
+
 	/// Return a deep copy of self.
 	virtual OpenVolumeMeshBaseProperty* clone() const = 0;
 
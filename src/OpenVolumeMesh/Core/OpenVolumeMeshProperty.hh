@@ -118,6 +118,9 @@ public:
 	void delete_element(size_t _idx) {
 		data_.erase(data_.begin() + _idx);
 	}
+	virtual void reset(size_t _idx) {
+		data_[_idx] = def_;
+	}
 
 public:
 
@@ -282,6 +285,9 @@ public:
     void delete_element(size_t _idx) {
         data_.erase(data_.begin() + _idx);
     }
+    virtual void reset(size_t _idx) {
+        data_[_idx] = def_;
+    }
 
 public:
 
@@ -419,6 +425,9 @@ public:
     virtual void delete_element(size_t _idx) {
         data_.erase(data_.begin() + _idx);
     }
+    virtual void reset(size_t _idx) {
+        data_[_idx] = def_;
+    }
 
 public:
 
@@ -83,6 +83,8 @@ public:
 
     virtual void delete_element(size_t _idx);
 
+    virtual void reset_element(size_t _idx);
+
     virtual void swap_elements(size_t _idx0, size_t _idx1);
 
     virtual void copy(size_t _src_idx, size_t _dst_idx);
@@ -111,6 +113,8 @@ protected:
 
     virtual void resize(size_t _size);
 
+    virtual void reserve(size_t _size);
+
     virtual void set_handle(const OpenVolumeMeshHandle& _handle);
 };
 
@@ -73,6 +73,11 @@ void PropertyPtr<PropT,HandleT>::resize(size_t _size) {
     ptr::shared_ptr<PropT>::get()->resize(_size);
 }
 
+template <class PropT, class HandleT>
+void PropertyPtr<PropT,HandleT>::reserve(size_t _size) {
+    ptr::shared_ptr<PropT>::get()->reserve(_size);
+}
+
 template <class PropT, class HandleT>
 const std::string& PropertyPtr<PropT,HandleT>::name() const {
     return ptr::shared_ptr<PropT>::get()->name();
@@ -83,6 +88,11 @@ void PropertyPtr<PropT,HandleT>::delete_element(size_t _idx) {
     ptr::shared_ptr<PropT>::get()->delete_element(_idx);
 }
 
+template <class PropT, class HandleT>
+void PropertyPtr<PropT,HandleT>::reset_element(size_t _idx) {
+    ptr::shared_ptr<PropT>::get()->reset(_idx);
+}
+
 template <class PropT, class HandleT>
 void PropertyPtr<PropT,HandleT>::swap_elements(size_t _idx0, size_t _idx1) {
     ptr::shared_ptr<PropT>::get()->swap(_idx0, _idx1);
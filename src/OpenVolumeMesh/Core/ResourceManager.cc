@@ -81,6 +81,28 @@ void ResourceManager::resize_cprops(size_t _nc) {
     resize_props(cell_props_, _nc);
 }
 
+void ResourceManager::reserve_vprops(size_t _nv) {
+
+    reserve_props(vertex_props_, _nv);
+}
+
+void ResourceManager::reserve_eprops(size_t _ne) {
+
+    reserve_props(edge_props_, _ne);
+    reserve_props(halfedge_props_, _ne*2u);
+}
+
+void ResourceManager::reserve_fprops(size_t _nf) {
+
+    reserve_props(face_props_, _nf);
+    reserve_props(halfface_props_, _nf*2u);
+}
+
+void ResourceManager::reserve_cprops(size_t _nc) {
+
+    reserve_props(cell_props_, _nc);
+}
+
 void ResourceManager::vertex_deleted(const VertexHandle& _h) {
 
     entity_deleted(vertex_props_, _h);
@@ -105,6 +127,30 @@ void ResourceManager::cell_deleted(const CellHandle& _h) {
     entity_deleted(cell_props_, _h);
 }
 
+void ResourceManager::vertex_reused(const VertexHandle& _h) {
+
+    entity_reused(vertex_props_, _h);
+}
+
+void ResourceManager::edge_reused(const EdgeHandle& _h) {
+
+    entity_reused(edge_props_, _h);
+    entity_reused(halfedge_props_, OpenVolumeMeshHandle(_h.idx()*2));
+    entity_reused(halfedge_props_, OpenVolumeMeshHandle(_h.idx()*2 + 1));
+}
+
+void ResourceManager::face_reused(const FaceHandle& _h) {
+
+    entity_reused(face_props_, _h);
+    entity_reused(halfface_props_, OpenVolumeMeshHandle(_h.idx()*2));
+    entity_reused(halfface_props_, OpenVolumeMeshHandle(_h.idx()*2 + 1));
+}
+
+void ResourceManager::cell_reused(const CellHandle& _h) {
+
+    entity_reused(cell_props_, _h);
+}
+
 void ResourceManager::swap_cell_properties(CellHandle _h1, CellHandle _h2){
 
     swap_property_elements(cell_props_begin(), cell_props_end(), _h1, _h2);
@@ -170,64 +216,58 @@ void ResourceManager::release_property(MeshPropHandle _handle) {
     remove_property(mesh_props_, _handle.idx());
 }
 
-void ResourceManager::delete_multiple_vertex_props(const std::vector<bool>& _tags) {
-
-    Properties::iterator vp_it = vertex_props_.begin();
-    Properties::iterator vp_end = vertex_props_.end();
-    for(; vp_it != vp_end; ++vp_it) {
-        (*vp_it)->delete_multiple_entries(_tags);
+void ResourceManager::delete_multiple_entries(Properties& _props, const std::vector<bool>& _tags, int _n_threads) {
+
+    // Each property compacts its own storage, so they can be processed in parallel
+    const int n = (int)_props.size();
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(_n_threads) schedule(dynamic, 1) if(_n_threads > 1 && n > 1)
+#else
+    (void)_n_threads;
+#endif
+    for(int i = 0; i < n; ++i) {
+        _props[i]->delete_multiple_entries(_tags);
     }
 }
 
-void ResourceManager::delete_multiple_edge_props(const std::vector<bool>& _tags) {
+void ResourceManager::delete_multiple_vertex_props(const std::vector<bool>& _tags, int _n_threads) {
+
+    delete_multiple_entries(vertex_props_, _tags, _n_threads);
+}
+
+void ResourceManager::delete_multiple_edge_props(const std::vector<bool>& _tags, int _n_threads) {
+
+    delete_multiple_entries(edge_props_, _tags, _n_threads);
 
-    Properties::iterator ep_it = edge_props_.begin();
-    Properties::iterator ep_end = edge_props_.end();
-    for(; ep_it != ep_end; ++ep_it) {
-        (*ep_it)->delete_multiple_entries(_tags);
-    }
     // Create tags vector for halfedges
     std::vector<bool> hetags;
+    hetags.reserve(2 * _tags.size());
     for(std::vector<bool>::const_iterator t_it = _tags.begin(),
             t_end = _tags.end(); t_it != t_end; ++t_it) {
         hetags.push_back(*t_it);
         hetags.push_back(*t_it);
     }
-    Properties::iterator hep_it = halfedge_props_.begin();
-    Properties::iterator hep_end = halfedge_props_.end();
-    for(; hep_it != hep_end; ++hep_it) {
-        (*hep_it)->delete_multiple_entries(hetags);
-    }
+    delete_multiple_entries(halfedge_props_, hetags, _n_threads);
 }
 
-void ResourceManager::delete_multiple_face_props(const std::vector<bool>& _tags) {
+void ResourceManager::delete_multiple_face_props(const std::vector<bool>& _tags, int _n_threads) {
+
+    delete_multiple_entries(face_props_, _tags, _n_threads);
 
-    Properties::iterator fp_it = face_props_.begin();
-    Properties::iterator fp_end = face_props_.end();
-    for(; fp_it != fp_end; ++fp_it) {
-        (*fp_it)->delete_multiple_entries(_tags);
-    }
     // Create tags vector for halffaces
     std::vector<bool> hftags;
+    hftags.reserve(2 * _tags.size());
     for(std::vector<bool>::const_iterator t_it = _tags.begin(),
             t_end = _tags.end(); t_it != t_end; ++t_it) {
         hftags.push_back(*t_it);
         hftags.push_back(*t_it);
     }
-    Properties::iterator hfp_it = halfface_props_.begin();
-    Properties::iterator hfp_end = halfface_props_.end();
-    for(; hfp_it != hfp_end; ++hfp_it) {
-        (*hfp_it)->delete_multiple_entries(hftags);
-    }
+    delete_multiple_entries(halfface_props_, hftags, _n_threads);
 }
 
-void ResourceManager::delete_multiple_cell_props(const std::vector<bool>& _tags) {
+void ResourceManager::delete_multiple_cell_props(const std::vector<bool>& _tags, int _n_threads) {
 
-    Properties::iterator cp_it = cell_props_.begin();
-    Properties::iterator cp_end = cell_props_.end();
-    for(; cp_it != cp_end; ++cp_it) {
-        (*cp_it)->delete_multiple_entries(_tags);
-    }
+    delete_multiple_entries(cell_props_, _tags, _n_threads);
 }
 
 } // Namespace OpenVolumeMesh
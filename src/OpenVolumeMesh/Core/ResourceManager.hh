@@ -92,6 +92,18 @@ public:
     /// Change size of stored cell properties
     void resize_cprops(size_t _nc);
 
+    /// Reserve memory for _nv elements in all vertex properties
+    void reserve_vprops(size_t _nv);
+
+    /// Reserve memory for _ne elements in all edge properties (and 2 * _ne in halfedge properties)
+    void reserve_eprops(size_t _ne);
+
+    /// Reserve memory for _nf elements in all face properties (and 2 * _nf in halfface properties)
+    void reserve_fprops(size_t _nf);
+
+    /// Reserve memory for _nc elements in all cell properties
+    void reserve_cprops(size_t _nc);
+
 protected:
 
     void vertex_deleted(const VertexHandle& _h);
@@ -102,6 +114,18 @@ protected:
 
     void cell_deleted(const CellHandle& _h);
 
+    /// Reset the properties of a vertex whose slot is used again
+    void vertex_reused(const VertexHandle& _h);
+
+    /// Reset the properties of an edge and its halfedges whose slot is used again
+    void edge_reused(const EdgeHandle& _h);
+
+    /// Reset the properties of a face and its halffaces whose slot is used again
+    void face_reused(const FaceHandle& _h);
+
+    /// Reset the properties of a cell whose slot is used again
+    void cell_reused(const CellHandle& _h);
+
     void swap_cell_properties(CellHandle _h1, CellHandle _h2);
 
     void swap_face_properties(FaceHandle _h1, FaceHandle _h2);
@@ -303,22 +327,31 @@ public:
 
 protected:
 
-    void delete_multiple_vertex_props(const std::vector<bool>& _tags);
+    /// Compact the properties, using up to _n_threads threads (one property per thread)
+    void delete_multiple_vertex_props(const std::vector<bool>& _tags, int _n_threads = 1);
 
-    void delete_multiple_edge_props(const std::vector<bool>& _tags);
+    void delete_multiple_edge_props(const std::vector<bool>& _tags, int _n_threads = 1);
 
-    void delete_multiple_face_props(const std::vector<bool>& _tags);
+    void delete_multiple_face_props(const std::vector<bool>& _tags, int _n_threads = 1);
 
-    void delete_multiple_cell_props(const std::vector<bool>& _tags);
+    void delete_multiple_cell_props(const std::vector<bool>& _tags, int _n_threads = 1);
 
 private:
 
+    static void delete_multiple_entries(Properties& _props, const std::vector<bool>& _tags, int _n_threads);
+
     template<class StdVecT>
     void resize_props(StdVecT& _vec, size_t _n);
 
+    template<class StdVecT>
+    void reserve_props(StdVecT& _vec, size_t _n);
+
     template<class StdVecT>
     void entity_deleted(StdVecT& _vec, const OpenVolumeMeshHandle& _h);
 
+    template<class StdVecT>
+    void entity_reused(StdVecT& _vec, const OpenVolumeMeshHandle& _h);
+
     template<class StdVecT>
     void remove_property(StdVecT& _vec, size_t _idx);
 
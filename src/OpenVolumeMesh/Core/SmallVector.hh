@@ -0,0 +1,135 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef SMALLVECTOR_HH_
+#define SMALLVECTOR_HH_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class SmallVector
+ *
+ * Vector that stores up to N elements inline and only allocates heap
+ * memory once it grows beyond that. Used for the short entity lists
+ * built up by circulators, so constructing them does not allocate in
+ * the common case.
+ */
+
+template <class T, size_t N>
+class SmallVector {
+public:
+
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    SmallVector() : size_(0) {}
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() { return heap_.empty() ? local_ : &heap_[0]; }
+    iterator end() { return begin() + size_; }
+
+    const_iterator begin() const { return heap_.empty() ? local_ : &heap_[0]; }
+    const_iterator end() const { return begin() + size_; }
+
+    T& operator[](size_t _i) { assert(_i < size_); return begin()[_i]; }
+    const T& operator[](size_t _i) const { assert(_i < size_); return begin()[_i]; }
+
+    void push_back(const T& _t) {
+        if(heap_.empty() && size_ < N) {
+            local_[size_] = _t;
+        } else {
+            // Move to the heap once the inline buffer is full
+            if(heap_.empty()) heap_.assign(local_, local_ + size_);
+            heap_.push_back(_t);
+        }
+        ++size_;
+    }
+
+    /// Insert _t into the sorted vector unless it is already contained
+    void insert_sorted_unique(const T& _t) {
+        const size_t pos = std::lower_bound(begin(), end(), _t) - begin();
+        if(pos < size_ && begin()[pos] == _t) return;
+        push_back(_t);
+        iterator it = begin();
+        std::copy_backward(it + pos, it + size_ - 1, it + size_);
+        it[pos] = _t;
+    }
+
+    void clear() {
+        heap_.clear();
+        size_ = 0;
+    }
+
+    /// Replace the contents by the elements [_first, _last)
+    void assign(const T* _first, const T* _last) {
+        const size_t n = _last - _first;
+        if(n <= N) {
+            heap_.clear();
+            std::copy(_first, _last, local_);
+        } else {
+            heap_.assign(_first, _last);
+        }
+        size_ = n;
+    }
+
+private:
+
+    T local_[N];
+
+    // Holds all elements once more than N have been added
+    std::vector<T> heap_;
+
+    size_t size_;
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* SMALLVECTOR_HH_ */
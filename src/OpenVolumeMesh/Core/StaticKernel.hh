@@ -0,0 +1,226 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef STATICKERNEL_HH_
+#define STATICKERNEL_HH_
+
+#include <iterator>
+
+#include "OpenVolumeMeshHandle.hh"
+#include "../System/Defines.hh"
+
+namespace OpenVolumeMesh {
+
+/**
+ * \class StaticEntityIter
+ *
+ * Iterator over the non-deleted entities of type HandleT of a StaticKernel.
+ *
+ * In contrast to VertexIter and friends, the iterator is fully inlined
+ * and queries the deletion flags without virtual calls. The number of
+ * entities is fixed at construction, so adding entities invalidates it.
+ */
+
+template <class MeshT, class HandleT>
+class StaticEntityIter {
+public:
+
+    // STL compliance
+    typedef std::forward_iterator_tag   iterator_category;
+    typedef int                         difference_type;
+    typedef const HandleT               value_type;
+    typedef const HandleT*              pointer;
+    typedef const HandleT&              reference;
+
+    StaticEntityIter() : mesh_(0), cur_handle_(-1), end_(0) {}
+
+    StaticEntityIter(const MeshT* _mesh, int _idx, int _end) :
+        mesh_(_mesh), cur_handle_(_idx), end_(_end) {
+
+        skip_deleted();
+    }
+
+    bool operator==(const StaticEntityIter& _c) const {
+        return cur_handle_ == _c.cur_handle_ && mesh_ == _c.mesh_;
+    }
+    bool operator!=(const StaticEntityIter& _c) const {
+        return !this->operator==(_c);
+    }
+
+    reference operator*() const { return cur_handle_; }
+
+    pointer operator->() const { return &cur_handle_; }
+
+    StaticEntityIter& operator++() {
+        cur_handle_ = HandleT(cur_handle_.idx() + 1);
+        skip_deleted();
+        return *this;
+    }
+
+    StaticEntityIter operator++(int) {
+        StaticEntityIter cpy = *this;
+        ++(*this);
+        return cpy;
+    }
+
+    bool valid() const { return cur_handle_.idx() < end_; }
+
+private:
+
+    void skip_deleted() {
+        // Qualified call, resolved at compile time
+        while(cur_handle_.idx() < end_ && mesh_->MeshT::is_deleted(cur_handle_)) {
+            cur_handle_ = HandleT(cur_handle_.idx() + 1);
+        }
+    }
+
+    const MeshT* mesh_;
+    HandleT cur_handle_;
+    int end_;
+};
+
+/// Pair of begin/end iterators usable in range-based for loops
+template <class IterT>
+class StaticEntityRange {
+public:
+    StaticEntityRange(const IterT& _begin, const IterT& _end) :
+        begin_(_begin), end_(_end) {}
+
+    const IterT& begin() const { return begin_; }
+    const IterT& end() const { return end_; }
+
+private:
+    IterT begin_;
+    IterT end_;
+};
+
+/**
+ * \class StaticKernel
+ *
+ * Mesh configuration with statically bound hot accessors.
+ *
+ * StaticKernel derives from an existing mesh type (e.g. a tetrahedral
+ * geometry kernel) and finalizes the entity counts, the deletion flags
+ * and add_vertex(). Calls through a StaticKernel object can then be
+ * resolved at compile time and inlined (with C++11, the overrides are
+ * final). Code that uses the polymorphic interface through TopologyKernel
+ * keeps working unchanged.
+ *
+ * The static_*() ranges iterate over the entities without any virtual
+ * calls, e.g.
+ *
+ * \code
+ * for(StaticTetrahedralMeshV3d::StaticVertexIter v_it = mesh.static_vertices().begin();
+ *     v_it != mesh.static_vertices().end(); ++v_it) { ... }
+ * \endcode
+ */
+
+template <class ParentT>
+class StaticKernel OVM_FINAL : public ParentT {
+public:
+
+    typedef StaticKernel<ParentT> This;
+
+    typedef StaticEntityIter<This, VertexHandle>   StaticVertexIter;
+    typedef StaticEntityIter<This, EdgeHandle>     StaticEdgeIter;
+    typedef StaticEntityIter<This, HalfEdgeHandle> StaticHalfEdgeIter;
+    typedef StaticEntityIter<This, FaceHandle>     StaticFaceIter;
+    typedef StaticEntityIter<This, HalfFaceHandle> StaticHalfFaceIter;
+    typedef StaticEntityIter<This, CellHandle>     StaticCellIter;
+
+    StaticKernel() {}
+
+    ~StaticKernel() {}
+
+    size_t n_vertices()  const OVM_FINAL { return ParentT::n_vertices();  }
+    size_t n_edges()     const OVM_FINAL { return ParentT::n_edges();     }
+    size_t n_halfedges() const OVM_FINAL { return ParentT::n_halfedges(); }
+    size_t n_faces()     const OVM_FINAL { return ParentT::n_faces();     }
+    size_t n_halffaces() const OVM_FINAL { return ParentT::n_halffaces(); }
+    size_t n_cells()     const OVM_FINAL { return ParentT::n_cells();     }
+
+    bool is_deleted(const VertexHandle& _h)   const OVM_FINAL { return ParentT::is_deleted(_h); }
+    bool is_deleted(const EdgeHandle& _h)     const OVM_FINAL { return ParentT::is_deleted(_h); }
+    bool is_deleted(const HalfEdgeHandle& _h) const OVM_FINAL { return ParentT::is_deleted(_h); }
+    bool is_deleted(const FaceHandle& _h)     const OVM_FINAL { return ParentT::is_deleted(_h); }
+    bool is_deleted(const HalfFaceHandle& _h) const OVM_FINAL { return ParentT::is_deleted(_h); }
+    bool is_deleted(const CellHandle& _h)     const OVM_FINAL { return ParentT::is_deleted(_h); }
+
+    using ParentT::add_vertex;
+
+    VertexHandle add_vertex() OVM_FINAL { return ParentT::add_vertex(); }
+
+    StaticEntityRange<StaticVertexIter> static_vertices() const {
+        const int n = (int)This::n_vertices();
+        return StaticEntityRange<StaticVertexIter>(StaticVertexIter(this, 0, n), StaticVertexIter(this, n, n));
+    }
+
+    StaticEntityRange<StaticEdgeIter> static_edges() const {
+        const int n = (int)This::n_edges();
+        return StaticEntityRange<StaticEdgeIter>(StaticEdgeIter(this, 0, n), StaticEdgeIter(this, n, n));
+    }
+
+    StaticEntityRange<StaticHalfEdgeIter> static_halfedges() const {
+        const int n = (int)This::n_halfedges();
+        return StaticEntityRange<StaticHalfEdgeIter>(StaticHalfEdgeIter(this, 0, n), StaticHalfEdgeIter(this, n, n));
+    }
+
+    StaticEntityRange<StaticFaceIter> static_faces() const {
+        const int n = (int)This::n_faces();
+        return StaticEntityRange<StaticFaceIter>(StaticFaceIter(this, 0, n), StaticFaceIter(this, n, n));
+    }
+
+    StaticEntityRange<StaticHalfFaceIter> static_halffaces() const {
+        const int n = (int)This::n_halffaces();
+        return StaticEntityRange<StaticHalfFaceIter>(StaticHalfFaceIter(this, 0, n), StaticHalfFaceIter(this, n, n));
+    }
+
+    StaticEntityRange<StaticCellIter> static_cells() const {
+        const int n = (int)This::n_cells();
+        return StaticEntityRange<StaticCellIter>(StaticCellIter(this, 0, n), StaticCellIter(this, n, n));
+    }
+};
+
+} // Namespace OpenVolumeMesh
+
+#endif /* STATICKERNEL_HH_ */
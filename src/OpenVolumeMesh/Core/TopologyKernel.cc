@@ -46,6 +46,10 @@
 
 #include <queue>
 
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
 #include "TopologyKernel.hh"
 
 namespace OpenVolumeMesh {
@@ -58,6 +62,8 @@ const FaceHandle        TopologyKernel::InvalidFaceHandle     = FaceHandle(-1);
 const HalfFaceHandle    TopologyKernel::InvalidHalfFaceHandle = HalfFaceHandle(-1);
 const CellHandle        TopologyKernel::InvalidCellHandle     = CellHandle(-1);
 
+const unsigned char     TopologyKernel::NoAdjacentHalfFace;
+
 TopologyKernel::TopologyKernel() :
     n_vertices_(0u),
     v_bottom_up_(true),
@@ -65,6 +71,19 @@ TopologyKernel::TopologyKernel() :
     f_bottom_up_(true),
     deferred_deletion(true),
     fast_deletion(true),
+    slot_reuse_enabled_(false),
+    n_threads_(0u),
+    edge_index_enabled_(false),
+    face_index_enabled_(false),
+    vc_incidences_enabled_(false),
+    hf_adjacency_enabled_(false),
+    boundary_index_enabled_(false),
+    cell_vertex_table_enabled_(false),
+    cell_neighbor_table_enabled_(false),
+    n_unused_face_halfedges_(0u),
+    n_unused_cell_halffaces_(0u),
+    fixed_cell_valence_(0u),
+    n_vertices_per_cell_(0u),
     needs_garbage_collection_(false)
 {
 }
@@ -74,8 +93,78 @@ TopologyKernel::~TopologyKernel() {
 
 //========================================================================================
 
+// Matches non-deleted edges between two given vertices, in either direction
+class TopologyKernel::EdgeMatch {
+public:
+    EdgeMatch(const std::vector<Edge>& _edges, const DeletionMask& _deleted,
+              const VertexHandle& _vh1, const VertexHandle& _vh2) :
+        edges_(_edges), deleted_(_deleted), vh1_(_vh1), vh2_(_vh2) {}
+
+    bool operator()(int _idx) const {
+        if(deleted_[_idx]) return false;
+        const Edge& e = edges_[_idx];
+        return (e.from_vertex() == vh1_ && e.to_vertex() == vh2_) ||
+               (e.from_vertex() == vh2_ && e.to_vertex() == vh1_);
+    }
+
+private:
+    const std::vector<Edge>& edges_;
+    const DeletionMask& deleted_;
+    VertexHandle vh1_;
+    VertexHandle vh2_;
+};
+
+// Matches non-deleted faces with the given vertices in either orientation
+class TopologyKernel::FaceMatch {
+public:
+    FaceMatch(const TopologyKernel& _kernel, const std::vector<VertexHandle>& _vs) :
+        kernel_(_kernel), vs_(_vs) {}
+
+    bool operator()(int _idx) const {
+        const FaceHandle fh(_idx);
+        return !kernel_.is_deleted(fh) && kernel_.match_face_vertices(fh, vs_) >= 0;
+    }
+
+private:
+    const TopologyKernel& kernel_;
+    const std::vector<VertexHandle>& vs_;
+};
+
+namespace {
+
+// Pop a slot from _free and mark it as alive again
+inline int take_free_slot(std::vector<int>& _free, DeletionMask& _deleted) {
+
+    const int idx = _free.back();
+    _free.pop_back();
+    assert(_deleted[idx]);
+    _deleted.set(idx, false);
+    return idx;
+}
+
+// Gather all deleted entries, the ones with the smallest index are taken first
+void collect_free_slots(const DeletionMask& _deleted, std::vector<int>& _free) {
+
+    _free.clear();
+    _free.reserve(_deleted.count());
+    for(size_t i = _deleted.size(); i > 0 && _free.size() < _deleted.count(); --i) {
+        if(_deleted[i - 1]) _free.push_back((int)i - 1);
+    }
+}
+
+} // Namespace
+
+//========================================================================================
+
 VertexHandle TopologyKernel::add_vertex() {
 
+    // Take the slot of a deleted vertex, it has no incident entities anymore
+    if(!free_vertices_.empty()) {
+        const VertexHandle vh(take_free_slot(free_vertices_, vertex_deleted_));
+        vertex_reused(vh);
+        return vh;
+    }
+
     ++n_vertices_;
     vertex_deleted_.push_back(false);
 
@@ -83,6 +172,12 @@ VertexHandle TopologyKernel::add_vertex() {
     if(v_bottom_up_) {
         outgoing_hes_per_vertex_.resize(n_vertices_);
     }
+    if(vc_incidences_enabled_) {
+        incident_cells_per_vertex_.resize(n_vertices_);
+    }
+    if(boundary_index_valid()) {
+        n_boundary_faces_per_vertex_.resize(n_vertices_, 0u);
+    }
 
     // Resize vertex props
     resize_vprops(n_vertices_);
@@ -93,6 +188,32 @@ VertexHandle TopologyKernel::add_vertex() {
 
 //========================================================================================
 
+VertexHandle TopologyKernel::add_vertices(size_t _n) {
+
+    const VertexHandle first((int)n_vertices_);
+
+    n_vertices_ += _n;
+    vertex_deleted_.resize(n_vertices_, false);
+
+    // Create items for vertex bottom-up incidences
+    if(v_bottom_up_) {
+        outgoing_hes_per_vertex_.resize(n_vertices_);
+    }
+    if(vc_incidences_enabled_) {
+        incident_cells_per_vertex_.resize(n_vertices_);
+    }
+    if(boundary_index_valid()) {
+        n_boundary_faces_per_vertex_.resize(n_vertices_, 0u);
+    }
+
+    // Resize vertex props
+    resize_vprops(n_vertices_);
+
+    return first;
+}
+
+//========================================================================================
+
 /// Add edge
 EdgeHandle TopologyKernel::add_edge(const VertexHandle& _fromVertex,
                                     const VertexHandle& _toVertex,
@@ -105,11 +226,18 @@ EdgeHandle TopologyKernel::add_edge(const VertexHandle& _fromVertex,
 
     // Test if edge does not exist, yet
     if(!_allowDuplicates) {
-        if(v_bottom_up_) {
+        if(edge_index_enabled_) {
+
+            const int idx = find_edge(_fromVertex, _toVertex);
+            if(idx >= 0) {
+                return EdgeHandle(idx);
+            }
+        } else if(v_bottom_up_) {
 
             assert((size_t)_fromVertex.idx() < outgoing_hes_per_vertex_.size());
-            std::vector<HalfEdgeHandle>& ohes = outgoing_hes_per_vertex_[_fromVertex.idx()];
-            for(std::vector<HalfEdgeHandle>::const_iterator he_it = ohes.begin(),
+            const IncidenceArray<HalfEdgeHandle>& outgoing = outgoing_hes_per_vertex_;
+            ConstArrayView<HalfEdgeHandle> ohes = outgoing[_fromVertex.idx()];
+            for(ConstArrayView<HalfEdgeHandle>::const_iterator he_it = ohes.begin(),
                     he_end = ohes.end(); he_it != he_end; ++he_it) {
                 if(halfedge(*he_it).to_vertex() == _toVertex) {
                     return edge_handle(*he_it);
@@ -129,14 +257,28 @@ EdgeHandle TopologyKernel::add_edge(const VertexHandle& _fromVertex,
     // Create edge object
     OpenVolumeMeshEdge e(_fromVertex, _toVertex);
 
-    // Store edge locally
-    edges_.push_back(e);
-    edge_deleted_.push_back(false);
+    EdgeHandle eh;
+    if(!free_edges_.empty()) {
 
-    // Resize props
-    resize_eprops(n_edges());
+        // Take the slot of a deleted edge
+        eh = EdgeHandle(take_free_slot(free_edges_, edge_deleted_));
+        edges_[eh.idx()] = e;
+        edge_reused(eh);
+    } else {
+
+        // Store edge locally
+        edges_.push_back(e);
+        edge_deleted_.push_back(false);
+
+        // Resize props
+        resize_eprops(n_edges());
+
+        eh = EdgeHandle((int)edges_.size()-1);
+    }
 
-    EdgeHandle eh((int)edges_.size()-1);
+    if(edge_index_enabled_) {
+        edge_index_.insert(edge_hash(_fromVertex, _toVertex), eh.idx());
+    }
 
     // Update vertex bottom-up incidences
     if(v_bottom_up_) {
@@ -151,6 +293,9 @@ EdgeHandle TopologyKernel::add_edge(const VertexHandle& _fromVertex,
     if(e_bottom_up_) {
         incident_hfs_per_he_.resize(n_halfedges());
     }
+    if(boundary_index_valid()) {
+        n_boundary_faces_per_edge_.resize(n_edges(), 0u);
+    }
 
     // Get handle of recently created edge
     return eh;
@@ -209,17 +354,31 @@ FaceHandle TopologyKernel::add_face(const std::vector<HalfEdgeHandle>& _halfedge
         // The halfedges are now guaranteed to be connected
     }
 
-    // Create face
-    OpenVolumeMeshFace face(_halfedges);
+    FaceHandle fh;
+    if(!free_faces_.empty()) {
+
+        // Take the slot of a deleted face
+        fh = FaceHandle(take_free_slot(free_faces_, face_deleted_));
+        store_face_halfedges(fh, _halfedges);
+        face_reused(fh);
+    } else {
 
-    faces_.push_back(face);
-    face_deleted_.push_back(false);
+        // Create face
+        face_offsets_.push_back(face_halfedges_.size());
+        face_valences_.push_back((unsigned int)_halfedges.size());
+        face_halfedges_.insert(face_halfedges_.end(), _halfedges.begin(), _halfedges.end());
+        face_deleted_.push_back(false);
 
-    // Get added face's handle
-    FaceHandle fh((int)faces_.size() - 1);
+        // Get added face's handle
+        fh = FaceHandle((int)face_offsets_.size() - 1);
 
-    // Resize props
-    resize_fprops(n_faces());
+        // Resize props
+        resize_fprops(n_faces());
+    }
+
+    if(face_index_enabled_) {
+        face_index_.insert(face_hash(fh), fh.idx());
+    }
 
     // Update edge bottom-up incidences
     if(e_bottom_up_) {
@@ -240,6 +399,12 @@ FaceHandle TopologyKernel::add_face(const std::vector<HalfEdgeHandle>& _halfedge
         incident_cell_per_hf_.resize(n_halffaces(), InvalidCellHandle);
     }
 
+    // A new face has no incident cells
+    if(boundary_index_valid()) {
+        boundary_face_pos_.resize(n_faces(), -1);
+        set_boundary_face(fh, true);
+    }
+
     // Return handle of recently created face
     return fh;
 }
@@ -288,6 +453,16 @@ FaceHandle TopologyKernel::add_face(const std::vector<VertexHandle>& _vertices)
 
 void TopologyKernel::reorder_incident_halffaces(const EdgeHandle& _eh) {
 
+    std::vector<HalfFaceHandle> forward, backward;
+    reorder_incident_halffaces(_eh, forward, backward);
+}
+
+//========================================================================================
+
+void TopologyKernel::reorder_incident_halffaces(const EdgeHandle& _eh,
+                                                std::vector<HalfFaceHandle>& _forward,
+                                                std::vector<HalfFaceHandle>& _backward) {
+
     /* Put halffaces in clockwise order via the
      * same cell property which now exists.
      * Note, this only works for manifold configurations though.
@@ -308,23 +483,28 @@ void TopologyKernel::reorder_incident_halffaces(const EdgeHandle& _eh) {
     for(unsigned char s = 0; s <= 1; s++) {
 
         HalfEdgeHandle cur_he = halfedge_handle(_eh, s);
-        std::vector<HalfFaceHandle> new_halffaces;
         HalfFaceHandle start_hf = InvalidHalfFaceHandle;
         HalfFaceHandle cur_hf = InvalidHalfFaceHandle;
 
         // Start with one incident halfface and go into the first direction
         assert((size_t)cur_he.idx() < incident_hfs_per_he_.size());
 
-        if(incident_hfs_per_he_[cur_he.idx()].size() != 0) {
+        IncidenceArray<HalfFaceHandle>::Row incident_halffaces = incident_hfs_per_he_[cur_he.idx()];
+        const size_t n_incident = incident_halffaces.size();
+
+        if(n_incident != 0) {
+
+            _forward.clear();
+            _backward.clear();
 
             // Get start halfface
-            cur_hf = *incident_hfs_per_he_[cur_he.idx()].begin();
+            cur_hf = incident_halffaces[0];
             start_hf = cur_hf;
 
             while(cur_hf != InvalidHalfFaceHandle) {
 
                 // Add halfface
-                new_halffaces.push_back(cur_hf);
+                _forward.push_back(cur_hf);
 
                 // Go to next halfface
                 cur_hf = adjacent_halfface_in_cell(cur_hf, cur_he);
@@ -336,14 +516,16 @@ void TopologyKernel::reorder_incident_halffaces(const EdgeHandle& _eh) {
                 if(cur_hf == start_hf) break;
                 // if one of the faces of the cell was already incident to another cell we need this check
                 // to prevent running into an infinite loop.
-                if(std::find(new_halffaces.begin(), new_halffaces.end(), cur_hf) != new_halffaces.end()) break;
+                if(std::find(_forward.begin(), _forward.end(), cur_hf) != _forward.end()) break;
             }
 
             // First direction has terminated
-            // If new_halffaces has the same size as old (unordered)
-            // vector of incident halffaces, we are done here
-            // If not, try the other way round
-            if(new_halffaces.size() != incident_hfs_per_he_[cur_he.idx()].size()) {
+            // If the new list has the same size as old (unordered)
+            // list of incident halffaces, we are done here
+            // If not, try the other way round.
+            // The halffaces found in this direction are collected
+            // in reverse order and prepended afterwards
+            if(_forward.size() != n_incident) {
 
                 // Get opposite of start halfface
                 cur_hf = start_hf;
@@ -357,19 +539,55 @@ void TopologyKernel::reorder_incident_halffaces(const EdgeHandle& _eh) {
 
                      // if one of the faces of the cell was already incident to another cell we need this check
                      // to prevent running into an infinite loop.
-                     if(std::find(new_halffaces.begin(), new_halffaces.end(), cur_hf) != new_halffaces.end()) break;
+                     if(std::find(_forward.begin(), _forward.end(), cur_hf) != _forward.end()) break;
+                     if(std::find(_backward.begin(), _backward.end(), cur_hf) != _backward.end()) break;
 
                      if(cur_hf != InvalidHalfFaceHandle)
-                         new_halffaces.insert(new_halffaces.begin(), cur_hf);
+                         _backward.push_back(cur_hf);
                      else break;
                 }
             }
 
-            // Everything worked just fine, set the new ordered vector
-            if(new_halffaces.size() == incident_hfs_per_he_[cur_he.idx()].size()) {
-                incident_hfs_per_he_[cur_he.idx()] = new_halffaces;
+            // Everything worked just fine, set the new ordered list
+            if(_forward.size() + _backward.size() == n_incident) {
+                HalfFaceHandle* out = std::reverse_copy(_backward.begin(), _backward.end(),
+                                                        incident_halffaces.begin());
+                std::copy(_forward.begin(), _forward.end(), out);
+            }
+        }
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::reorder_all_incident_halffaces() {
+
+    const int n_edges = (int)edges_.size();
+
+#ifdef USE_OPENMP
+    // Edges are independent of each other, each one only
+    // rewrites the incidence lists of its own two halfedges
+    const int n_threads = effective_num_threads();
+    if(n_threads > 1 && n_edges >= 1024 * n_threads) {
+
+        #pragma omp parallel num_threads(n_threads)
+        {
+            std::vector<HalfFaceHandle> forward, backward;
+
+            #pragma omp for schedule(dynamic, 1024)
+            for(int i = 0; i < n_edges; ++i) {
+                if(edge_deleted_[i]) continue;
+                reorder_incident_halffaces(EdgeHandle(i), forward, backward);
             }
         }
+        return;
+    }
+#endif
+
+    std::vector<HalfFaceHandle> forward, backward;
+    for(int i = 0; i < n_edges; ++i) {
+        if(edge_deleted_[i]) continue;
+        reorder_incident_halffaces(EdgeHandle(i), forward, backward);
     }
 }
 
@@ -382,9 +600,17 @@ CellHandle TopologyKernel::add_cell(const std::vector<HalfFaceHandle>& _halfface
     // Assert that halffaces have valid indices
     for(std::vector<HalfFaceHandle>::const_iterator it = _halffaces.begin(),
             end = _halffaces.end(); it != end; ++it)
-        assert(it->is_valid() && ((size_t)it->idx() < faces_.size() * 2u));
+        assert(it->is_valid() && ((size_t)it->idx() < face_offsets_.size() * 2u));
 #endif
 
+    if(fixed_cell_valence_ != 0u && _halffaces.size() != fixed_cell_valence_) {
+#ifndef NDEBUG
+        std::cerr << "add_cell(): Cells of this mesh must have exactly "
+                  << fixed_cell_valence_ << " half-faces!" << std::endl;
+#endif
+        return InvalidCellHandle;
+    }
+
     // Perform topology check
     if(_topologyCheck) {
 
@@ -403,7 +629,7 @@ CellHandle TopologyKernel::add_cell(const std::vector<HalfFaceHandle>& _halfface
                 end = _halffaces.end(); it != end; ++it) {
 
             OpenVolumeMeshFace hface = halfface(*it);
-            for(std::vector<HalfEdgeHandle>::const_iterator he_it = hface.halfedges().begin(),
+            for(Face::HalfEdgeView::const_iterator he_it = hface.halfedges().begin(),
                     he_end = hface.halfedges().end(); he_it != he_end; ++he_it) {
                 incidentHalfedges.insert(*he_it);
                 incidentEdges.insert(edge_handle(*he_it));
@@ -420,16 +646,34 @@ CellHandle TopologyKernel::add_cell(const std::vector<HalfFaceHandle>& _halfface
         // The halffaces are now guaranteed to form a two-manifold
     }
 
-    // Create new cell
-    OpenVolumeMeshCell cell(_halffaces);
+    CellHandle ch;
+    if(!free_cells_.empty()) {
 
-    cells_.push_back(cell);
-    cell_deleted_.push_back(false);
+        // Take the slot of a deleted cell
+        ch = CellHandle(take_free_slot(free_cells_, cell_deleted_));
+        store_cell_halffaces(ch, _halffaces);
+        cell_reused(ch);
+    } else {
 
-    // Resize props
-    resize_cprops(n_cells());
+        // Create new cell
+        if(fixed_cell_valence_ == 0u) {
+            cell_offsets_.push_back(cell_halffaces_.size());
+            cell_valences_.push_back((unsigned int)_halffaces.size());
+        }
+        cell_halffaces_.insert(cell_halffaces_.end(), _halffaces.begin(), _halffaces.end());
+        cell_deleted_.push_back(false);
+
+        // Resize props
+        resize_cprops(n_cells());
+
+        ch = CellHandle((int)n_cells()-1);
+    }
 
-    CellHandle ch((int)cells_.size()-1);
+    // Needed by the halfface reordering below
+    if(hf_adjacency_enabled_) {
+        adjacent_hf_per_cell_.resize(n_cells());
+        update_cell_halfface_adjacency(ch);
+    }
 
     // Update face bottom-up incidences
     if(f_bottom_up_) {
@@ -476,16 +720,297 @@ CellHandle TopologyKernel::add_cell(const std::vector<HalfFaceHandle>& _halfface
         }
     }
 
+    if(vc_incidences_enabled_) {
+        add_vertex_cell_incidences(ch);
+    }
+    if(boundary_index_valid()) {
+        for(std::vector<HalfFaceHandle>::const_iterator it = _halffaces.begin(),
+                end = _halffaces.end(); it != end; ++it) {
+            update_boundary_face(face_handle(*it));
+        }
+    }
+    if(cell_vertex_table_enabled_) {
+        update_cell_vertex_table(ch);
+    }
+    if(cell_neighbor_table_valid()) {
+        cell_neighbor_table_.resize(n_cells() * fixed_cell_valence_, -1);
+        update_cell_neighbors(ch);
+    }
+
     return ch;
 }
 
 //========================================================================================
 
+void TopologyKernel::reserve(size_t _nv, size_t _ne, size_t _nf, size_t _nc) {
+
+    // Halfedges per face and halffaces per cell
+    const size_t face_valence = (fixed_cell_valence_ == 4u) ? 3u : 4u;
+    const size_t cell_valence = fixed_cell_valence_ ? fixed_cell_valence_ : 6u;
+
+    vertex_deleted_.reserve(_nv);
+
+    edges_.reserve(_ne);
+    edge_deleted_.reserve(_ne);
+
+    face_offsets_.reserve(_nf);
+    face_valences_.reserve(_nf);
+    face_halfedges_.reserve(_nf * face_valence);
+    face_deleted_.reserve(_nf);
+
+    if(fixed_cell_valence_ == 0u) {
+        cell_offsets_.reserve(_nc);
+        cell_valences_.reserve(_nc);
+    }
+    cell_halffaces_.reserve(_nc * cell_valence);
+    cell_deleted_.reserve(_nc);
+
+    // Incrementally built lists take up to twice their size
+    // (see IncidenceArray), hence the factor of two
+    if(v_bottom_up_) {
+        outgoing_hes_per_vertex_.reserve(_nv, 2u * 2u * _ne);
+    }
+    if(e_bottom_up_) {
+        incident_hfs_per_he_.reserve(2u * _ne, 2u * 2u * _nf * face_valence);
+    }
+    if(f_bottom_up_) {
+        incident_cell_per_hf_.reserve(2u * _nf);
+    }
+    if(vc_incidences_enabled_) {
+        incident_cells_per_vertex_.reserve(_nv, 2u * _nc * (n_vertices_per_cell_ ? n_vertices_per_cell_ : 8u));
+    }
+    if(hf_adjacency_enabled_) {
+        adjacent_hf_per_cell_.reserve(_nc, _nc * cell_valence * face_valence);
+    }
+
+    if(edge_index_enabled_) {
+        edge_index_.reserve(_ne);
+    }
+    if(face_index_enabled_) {
+        face_index_.reserve(_nf);
+    }
+    if(cell_vertex_table_enabled_) {
+        cell_vertex_table_.reserve(_nc * n_vertices_per_cell_);
+    }
+    if(cell_neighbor_table_enabled_) {
+        cell_neighbor_table_.reserve(_nc * fixed_cell_valence_);
+    }
+
+    reserve_vprops(_nv);
+    reserve_eprops(_ne);
+    reserve_fprops(_nf);
+    reserve_cprops(_nc);
+}
+
+//========================================================================================
+
+CellHandle TopologyKernel::add_cells(const int* _faceVertices, const size_t* _faceOffsets,
+                                     const size_t* _cellFaceOffsets, size_t _nCells) {
+
+    if(_nCells == 0) return InvalidCellHandle;
+
+    if(fixed_cell_valence_ != 0u) {
+        for(size_t c = 0; c < _nCells; ++c) {
+            if(_cellFaceOffsets[c + 1] - _cellFaceOffsets[c] != fixed_cell_valence_) {
+#ifndef NDEBUG
+                std::cerr << "add_cells(): Cells of this mesh must have exactly "
+                          << fixed_cell_valence_ << " half-faces!" << std::endl;
+#endif
+                return InvalidCellHandle;
+            }
+        }
+    }
+
+    /*
+     * Look up edges and faces in lists attached to their smallest
+     * vertex. As the cells of typical input meshes are spatially
+     * coherent, these lists are mostly still in cache when they are
+     * searched, contrary to a global hash table.
+     * A new entry is put at the front of its list, so the last match
+     * found is the one with the smallest handle.
+     */
+    std::vector<int> firstEdge(n_vertices_, -1), nextEdge(edges_.size(), -1);
+    std::vector<int> firstFace(n_vertices_, -1), nextFace(face_offsets_.size(), -1);
+
+    for(size_t i = 0; i < edges_.size(); ++i) {
+        if(edge_deleted_[i]) continue;
+        const int v = std::min(edges_[i].from_vertex().idx(), edges_[i].to_vertex().idx());
+        nextEdge[i] = firstEdge[v];
+        firstEdge[v] = (int)i;
+    }
+    for(size_t i = 0; i < face_offsets_.size(); ++i) {
+        if(face_deleted_[i]) continue;
+        const HalfEdgeHandle* hes = &face_halfedges_[0] + face_offsets_[i];
+        int v = halfedge_from_vertex(hes[0]).idx();
+        for(size_t k = 1; k < face_valences_[i]; ++k) {
+            v = std::min(v, halfedge_from_vertex(hes[k]).idx());
+        }
+        nextFace[i] = firstFace[v];
+        firstFace[v] = (int)i;
+    }
+
+    const CellHandle firstCell((int)n_cells());
+    const size_t nCellFaces = _cellFaceOffsets[_nCells] - _cellFaceOffsets[0];
+
+    cell_halffaces_.reserve(cell_halffaces_.size() + nCellFaces);
+    if(fixed_cell_valence_ == 0u) {
+        cell_offsets_.reserve(cell_offsets_.size() + _nCells);
+        cell_valences_.reserve(cell_valences_.size() + _nCells);
+    }
+
+    std::vector<VertexHandle> vs;
+
+    for(size_t c = 0; c < _nCells; ++c) {
+
+        if(fixed_cell_valence_ == 0u) {
+            cell_offsets_.push_back(cell_halffaces_.size());
+            cell_valences_.push_back((unsigned int)(_cellFaceOffsets[c + 1] - _cellFaceOffsets[c]));
+        }
+
+        for(size_t j = _cellFaceOffsets[c]; j < _cellFaceOffsets[c + 1]; ++j) {
+
+            vs.clear();
+            int minVertex = _faceVertices[_faceOffsets[j]];
+            for(size_t k = _faceOffsets[j]; k < _faceOffsets[j + 1]; ++k) {
+                assert(_faceVertices[k] >= 0 && (size_t)_faceVertices[k] < n_vertices_);
+                vs.push_back(VertexHandle(_faceVertices[k]));
+                minVertex = std::min(minVertex, _faceVertices[k]);
+            }
+            assert(vs.size() > 2);
+
+            int f = -1, orientation = -1;
+            for(int i = firstFace[minVertex]; i >= 0; i = nextFace[i]) {
+                const int m = match_face_vertices(FaceHandle(i), vs);
+                if(m >= 0) {
+                    f = i;
+                    orientation = m;
+                }
+            }
+            if(f >= 0) {
+                // Face exists, use the half-face with matching orientation
+                cell_halffaces_.push_back(halfface_handle(FaceHandle(f), (unsigned char)orientation));
+                continue;
+            }
+
+            // Create face, adding missing edges
+            const FaceHandle fh((int)face_offsets_.size());
+            face_offsets_.push_back(face_halfedges_.size());
+            face_valences_.push_back((unsigned int)vs.size());
+            face_deleted_.push_back(false);
+            nextFace.push_back(firstFace[minVertex]);
+            firstFace[minVertex] = fh.idx();
+
+            for(size_t k = 0; k < vs.size(); ++k) {
+
+                const VertexHandle& from = vs[k];
+                const VertexHandle& to = vs[(k + 1) % vs.size()];
+                const int v = std::min(from.idx(), to.idx());
+
+                int e = -1;
+                for(int i = firstEdge[v]; i >= 0; i = nextEdge[i]) {
+                    if((edges_[i].from_vertex() == from && edges_[i].to_vertex() == to) ||
+                       (edges_[i].from_vertex() == to && edges_[i].to_vertex() == from)) {
+                        e = i;
+                    }
+                }
+                if(e < 0) {
+                    e = (int)edges_.size();
+                    edges_.push_back(OpenVolumeMeshEdge(from, to));
+                    edge_deleted_.push_back(false);
+                    nextEdge.push_back(firstEdge[v]);
+                    firstEdge[v] = e;
+                }
+
+                face_halfedges_.push_back(halfedge_handle(EdgeHandle(e),
+                                                          edges_[e].from_vertex() == from ? 0 : 1));
+            }
+
+            cell_halffaces_.push_back(halfface_handle(fh, 0));
+        }
+    }
+
+    cell_deleted_.resize(n_cells(), false);
+
+    // Resize props
+    resize_eprops(n_edges());
+    resize_fprops(n_faces());
+    resize_cprops(n_cells());
+
+    // Needed by the halfface reordering below
+    if(hf_adjacency_enabled_) {
+        compute_cell_halfface_adjacency();
+    }
+
+    // Update bottom-up incidences for the whole mesh
+    if(v_bottom_up_) {
+        compute_vertex_bottom_up_incidences();
+    }
+    if(e_bottom_up_) {
+        compute_edge_bottom_up_incidences();
+    }
+    if(f_bottom_up_) {
+        compute_face_bottom_up_incidences();
+    }
+    if(e_bottom_up_ && f_bottom_up_) {
+        reorder_all_incident_halffaces();
+    }
+    if(vc_incidences_enabled_) {
+        compute_vertex_cell_incidences();
+    }
+    if(boundary_index_valid()) {
+        compute_boundary_index();
+    }
+    if(cell_neighbor_table_valid()) {
+        compute_cell_neighbor_table();
+    }
+
+    if(edge_index_enabled_) {
+        compute_edge_index();
+    }
+    if(face_index_enabled_) {
+        compute_face_index();
+    }
+    if(cell_vertex_table_enabled_) {
+        for(size_t c = firstCell.idx(); c < n_cells(); ++c) {
+            update_cell_vertex_table(CellHandle((int)c));
+        }
+    }
+
+    return firstCell;
+}
+
+//========================================================================================
+
 /// Set the vertices of an edge
 void TopologyKernel::set_edge(const EdgeHandle& _eh, const VertexHandle& _fromVertex, const VertexHandle& _toVertex) {
 
     Edge& e = edge(_eh);
 
+    // The vertices of the edge's faces and cells change,
+    // take them out of the affected structures first
+    std::set<FaceHandle> faces;
+    std::set<CellHandle> cells;
+    if(face_index_enabled_ || boundary_index_valid() ||
+       vc_incidences_enabled_ || cell_vertex_table_enabled_) {
+        std::set<EdgeHandle> edges;
+        edges.insert(_eh);
+        get_incident_faces(edges, faces);
+        get_incident_cells(faces, cells);
+    }
+    for(std::set<FaceHandle>::const_iterator f_it = faces.begin(); f_it != faces.end(); ++f_it) {
+        if(face_index_enabled_) {
+            face_index_.erase(face_hash(*f_it), f_it->idx());
+        }
+        if(boundary_index_valid()) {
+            set_boundary_face(*f_it, false);
+        }
+    }
+    if(vc_incidences_enabled_) {
+        for(std::set<CellHandle>::const_iterator c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+            remove_vertex_cell_incidences(*c_it);
+        }
+    }
+
     // Update bottom-up entries
     if(has_vertex_bottom_up_incidences()) {
 
@@ -495,7 +1020,7 @@ void TopologyKernel::set_edge(const EdgeHandle& _eh, const VertexHandle& _fromVe
         const HalfEdgeHandle heh0 = halfedge_handle(_eh, 0);
         const HalfEdgeHandle heh1 = halfedge_handle(_eh, 1);
 
-        std::vector<HalfEdgeHandle>::iterator h_end =
+        HalfEdgeHandle* h_end =
         		std::remove(outgoing_hes_per_vertex_[fv.idx()].begin(), outgoing_hes_per_vertex_[fv.idx()].end(), heh0);
         outgoing_hes_per_vertex_[fv.idx()].resize(h_end - outgoing_hes_per_vertex_[fv.idx()].begin());
 
@@ -506,8 +1031,30 @@ void TopologyKernel::set_edge(const EdgeHandle& _eh, const VertexHandle& _fromVe
         outgoing_hes_per_vertex_[_toVertex.idx()].push_back(heh1);
     }
 
+    if(edge_index_enabled_) {
+        edge_index_.erase(edge_hash(e.from_vertex(), e.to_vertex()), _eh.idx());
+        edge_index_.insert(edge_hash(_fromVertex, _toVertex), _eh.idx());
+    }
+
     e.set_from_vertex(_fromVertex);
     e.set_to_vertex(_toVertex);
+
+    for(std::set<FaceHandle>::const_iterator f_it = faces.begin(); f_it != faces.end(); ++f_it) {
+        if(face_index_enabled_) {
+            face_index_.insert(face_hash(*f_it), f_it->idx());
+        }
+        if(boundary_index_valid()) {
+            update_boundary_face(*f_it);
+        }
+    }
+    for(std::set<CellHandle>::const_iterator c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+        if(vc_incidences_enabled_) {
+            add_vertex_cell_incidences(*c_it);
+        }
+        if(cell_vertex_table_enabled_) {
+            update_cell_vertex_table(*c_it);
+        }
+    }
 }
 
 //========================================================================================
@@ -515,19 +1062,30 @@ void TopologyKernel::set_edge(const EdgeHandle& _eh, const VertexHandle& _fromVe
 /// Set the half-edges of a face
 void TopologyKernel::set_face(const FaceHandle& _fh, const std::vector<HalfEdgeHandle>& _hes) {
 
-    Face& f = face(_fh);
+    // The vertices and edges of the face's cells change
+    std::set<CellHandle> cells;
+    if(vc_incidences_enabled_ || hf_adjacency_enabled_ || cell_vertex_table_enabled_) {
+        std::set<FaceHandle> faces;
+        faces.insert(_fh);
+        get_incident_cells(faces, cells);
+    }
+    if(vc_incidences_enabled_) {
+        for(std::set<CellHandle>::const_iterator c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+            remove_vertex_cell_incidences(*c_it);
+        }
+    }
 
     if(has_edge_bottom_up_incidences()) {
 
         const HalfFaceHandle hf0 = halfface_handle(_fh, 0);
         const HalfFaceHandle hf1 = halfface_handle(_fh, 1);
 
-        const std::vector<HalfEdgeHandle>& hes = f.halfedges();
+        const Face::HalfEdgeView hes = face(_fh).halfedges();
 
-        for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin(),
+        for(Face::HalfEdgeView::const_iterator he_it = hes.begin(),
                 he_end = hes.end(); he_it != he_end; ++he_it) {
 
-        	std::vector<HalfFaceHandle>::iterator h_end =
+        	HalfFaceHandle* h_end =
         			std::remove(incident_hfs_per_he_[he_it->idx()].begin(),
                         		incident_hfs_per_he_[he_it->idx()].end(), hf0);
             incident_hfs_per_he_[he_it->idx()].resize(h_end - incident_hfs_per_he_[he_it->idx()].begin());
@@ -547,7 +1105,93 @@ void TopologyKernel::set_face(const FaceHandle& _fh, const std::vector<HalfEdgeH
         // TODO: Reorder incident half-faces
     }
 
-    f.set_halfedges(_hes);
+    if(face_index_enabled_) {
+        face_index_.erase(face_hash(_fh), _fh.idx());
+    }
+    if(boundary_index_valid()) {
+        set_boundary_face(_fh, false);
+    }
+
+    store_face_halfedges(_fh, _hes);
+
+    if(face_index_enabled_) {
+        face_index_.insert(face_hash(_fh), _fh.idx());
+    }
+    if(boundary_index_valid()) {
+        update_boundary_face(_fh);
+    }
+
+    for(std::set<CellHandle>::const_iterator c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+        if(vc_incidences_enabled_) {
+            add_vertex_cell_incidences(*c_it);
+        }
+        if(hf_adjacency_enabled_) {
+            update_cell_halfface_adjacency(*c_it);
+        }
+        if(cell_vertex_table_enabled_) {
+            update_cell_vertex_table(*c_it);
+        }
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::store_face_halfedges(const FaceHandle& _fh, const std::vector<HalfEdgeHandle>& _hes) {
+
+    assert(_fh.is_valid() && (size_t)_fh.idx() < face_offsets_.size());
+
+    if(face_valences_[_fh.idx()] == _hes.size()) {
+        // Overwrite in place
+        std::copy(_hes.begin(), _hes.end(), face_halfedges_begin(_fh));
+        return;
+    }
+
+    // Valence changed, append halfedges at the end of the array
+    const size_t old_offset = face_offsets_[_fh.idx()];
+    const size_t old_valence = face_valences_[_fh.idx()];
+
+    face_offsets_[_fh.idx()] = face_halfedges_.size();
+    face_valences_[_fh.idx()] = (unsigned int)_hes.size();
+    face_halfedges_.insert(face_halfedges_.end(), _hes.begin(), _hes.end());
+
+    release_face_halfedges(old_offset, old_valence);
+}
+
+//========================================================================================
+
+void TopologyKernel::release_face_halfedges(size_t _offset, size_t _valence) {
+
+    if(_offset + _valence == face_halfedges_.size()) {
+        // Slots at the end of the array can be dropped right away
+        face_halfedges_.resize(_offset);
+    } else {
+        n_unused_face_halfedges_ += _valence;
+    }
+
+    // Compact as soon as more than half of the array is unused
+    if(n_unused_face_halfedges_ > face_halfedges_.size() / 2u) {
+        compact_face_halfedges();
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compact_face_halfedges() {
+
+    if(n_unused_face_halfedges_ == 0u) return;
+
+    std::vector<HalfEdgeHandle> newHalfedges;
+    newHalfedges.reserve(face_halfedges_.size() - n_unused_face_halfedges_);
+
+    for(size_t i = 0; i < face_offsets_.size(); ++i) {
+        const size_t offset = face_offsets_[i];
+        face_offsets_[i] = newHalfedges.size();
+        newHalfedges.insert(newHalfedges.end(), face_halfedges_.begin() + offset,
+                            face_halfedges_.begin() + offset + face_valences_[i]);
+    }
+
+    face_halfedges_.swap(newHalfedges);
+    n_unused_face_halfedges_ = 0u;
 }
 
 //========================================================================================
@@ -555,12 +1199,19 @@ void TopologyKernel::set_face(const FaceHandle& _fh, const std::vector<HalfEdgeH
 /// Set the half-faces of a cell
 void TopologyKernel::set_cell(const CellHandle& _ch, const std::vector<HalfFaceHandle>& _hfs) {
 
-    Cell& c = cell(_ch);
+    // Cells that may no longer be adjacent to _ch
+    SmallVector<CellHandle, 8> old_neighbors;
+    if(cell_neighbor_table_valid()) {
+        for(unsigned int i = 0; i < fixed_cell_valence_; ++i) {
+            const CellHandle nb = cell_neighbor(_ch, i);
+            if(nb.is_valid()) old_neighbors.push_back(nb);
+        }
+    }
 
     if(has_face_bottom_up_incidences()) {
 
-        const std::vector<HalfFaceHandle>& hfs = c.halffaces();
-        for(std::vector<HalfFaceHandle>::const_iterator hf_it = hfs.begin(),
+        const Cell::HalfFaceView hfs = cell(_ch).halffaces();
+        for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
                 hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
 
             incident_cell_per_hf_[*hf_it] = InvalidCellHandle;
@@ -573,7 +1224,129 @@ void TopologyKernel::set_cell(const CellHandle& _ch, const std::vector<HalfFaceH
         }
     }
 
-    c.set_halffaces(_hfs);
+    if(vc_incidences_enabled_) {
+        remove_vertex_cell_incidences(_ch);
+    }
+    if(boundary_index_valid()) {
+        const Cell::HalfFaceView hfs = cell(_ch).halffaces();
+        for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
+                hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
+            update_boundary_face(face_handle(*hf_it));
+        }
+    }
+
+    store_cell_halffaces(_ch, _hfs);
+
+    if(vc_incidences_enabled_) {
+        add_vertex_cell_incidences(_ch);
+    }
+    if(hf_adjacency_enabled_) {
+        update_cell_halfface_adjacency(_ch);
+    }
+    if(cell_neighbor_table_valid()) {
+        update_cell_neighbors(_ch);
+        for(SmallVector<CellHandle, 8>::const_iterator it = old_neighbors.begin();
+                it != old_neighbors.end(); ++it) {
+            update_cell_neighbors(*it);
+        }
+    }
+    if(boundary_index_valid()) {
+        for(std::vector<HalfFaceHandle>::const_iterator hf_it = _hfs.begin(),
+                hf_end = _hfs.end(); hf_it != hf_end; ++hf_it) {
+            update_boundary_face(face_handle(*hf_it));
+        }
+    }
+    if(cell_vertex_table_enabled_) {
+        update_cell_vertex_table(_ch);
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::set_fixed_cell_valence(unsigned int _valence) {
+
+    assert(n_cells() == 0u);
+
+    fixed_cell_valence_ = _valence;
+    cell_offsets_.clear();
+    cell_valences_.clear();
+    cell_halffaces_.clear();
+    n_unused_cell_halffaces_ = 0u;
+}
+
+//========================================================================================
+
+void TopologyKernel::store_cell_halffaces(const CellHandle& _ch, const std::vector<HalfFaceHandle>& _hfs) {
+
+    assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells());
+
+    if(valence(_ch) == _hfs.size()) {
+        // Overwrite in place
+        std::copy(_hfs.begin(), _hfs.end(), cell_halffaces_begin(_ch));
+        return;
+    }
+
+    if(fixed_cell_valence_ != 0u) {
+#ifndef NDEBUG
+        std::cerr << "set_cell(): Cells of this mesh must have exactly "
+                  << fixed_cell_valence_ << " half-faces!" << std::endl;
+#endif
+        assert(false);
+        return;
+    }
+
+    // Valence changed, append halffaces at the end of the array
+    const size_t old_offset = cell_offsets_[_ch.idx()];
+    const size_t old_valence = cell_valences_[_ch.idx()];
+
+    cell_offsets_[_ch.idx()] = cell_halffaces_.size();
+    cell_valences_[_ch.idx()] = (unsigned int)_hfs.size();
+    cell_halffaces_.insert(cell_halffaces_.end(), _hfs.begin(), _hfs.end());
+
+    release_cell_halffaces(old_offset, old_valence);
+}
+
+//========================================================================================
+
+void TopologyKernel::release_cell_halffaces(size_t _offset, size_t _valence) {
+
+    if(_offset + _valence == cell_halffaces_.size()) {
+        // Slots at the end of the array can be dropped right away
+        cell_halffaces_.resize(_offset);
+    } else if(fixed_cell_valence_ != 0u) {
+        // Packed storage, close the gap
+        cell_halffaces_.erase(cell_halffaces_.begin() + _offset,
+                              cell_halffaces_.begin() + _offset + _valence);
+    } else {
+        n_unused_cell_halffaces_ += _valence;
+    }
+
+    // Compact as soon as more than half of the array is unused
+    if(n_unused_cell_halffaces_ > cell_halffaces_.size() / 2u) {
+        compact_cell_halffaces();
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compact_cell_halffaces() {
+
+    if(n_unused_cell_halffaces_ == 0u) return;
+
+    assert(fixed_cell_valence_ == 0u);
+
+    std::vector<HalfFaceHandle> newHalffaces;
+    newHalffaces.reserve(cell_halffaces_.size() - n_unused_cell_halffaces_);
+
+    for(size_t i = 0; i < cell_offsets_.size(); ++i) {
+        const size_t offset = cell_offsets_[i];
+        cell_offsets_[i] = newHalffaces.size();
+        newHalffaces.insert(newHalffaces.end(), cell_halffaces_.begin() + offset,
+                            cell_halffaces_.begin() + offset + cell_valences_[i]);
+    }
+
+    cell_halffaces_.swap(newHalffaces);
+    n_unused_cell_halffaces_ = 0u;
 }
 
 //========================================================================================
@@ -723,40 +1496,172 @@ void TopologyKernel::collect_garbage()
     if (!deferred_deletion_enabled() || !needs_garbage_collection_)
         return; // nothing todo
 
-    deferred_deletion = false;
+    // The entities marked as deleted are removed along with the tagged ones
+    const std::vector<bool> noTags;
+    delete_tagged(noTags, noTags, noTags, noTags);
+}
 
-    for (int i = (int)n_cells(); i > 0; --i)
-        if (is_deleted(CellHandle(i-1)))
-        {
-            cell_deleted_[i-1] = false;
-            delete_cell_core(CellHandle(i-1));
-        }
+/**
+ * \brief Delete all entities that are marked as deleted
+ *
+ * @param _remap Receives the new index of each vertex, edge, face and cell
+ */
+void TopologyKernel::collect_garbage(HandleRemap& _remap)
+{
+    const std::vector<bool> noTags;
+    delete_tagged(noTags, noTags, noTags, noTags, &_remap);
+}
 
-    for (int i = (int)n_faces(); i > 0; --i)
-        if (is_deleted(FaceHandle(i-1)))
-        {
-            face_deleted_[i-1] = false;
-            delete_face_core(FaceHandle(i-1));
-        }
+//========================================================================================
 
-    for (int i = (int)n_edges(); i > 0; --i)
-        if (is_deleted(EdgeHandle(i-1)))
-        {
-            edge_deleted_[i-1] = false;
-            delete_edge_core(EdgeHandle(i-1));
+/**
+ * \brief Delete all tagged entities from the mesh in one pass
+ *
+ * Entities incident to a tagged entity of lower dimension are
+ * deleted as well, just like with delete_vertex() etc. Entities
+ * that are marked as deleted (deferred deletion) are removed, too.
+ * The remaining entities keep their order and are renumbered
+ * consecutively, the incidences, indices and properties are remapped
+ * in time linear in the size of the mesh.
+ *
+ * @param _vertexTags The vertices to be deleted, may be empty
+ * @param _edgeTags The edges to be deleted, may be empty
+ * @param _faceTags The faces to be deleted, may be empty
+ * @param _cellTags The cells to be deleted, may be empty
+ * @param _remap If not null, receives the new index of each entity
+ */
+void TopologyKernel::delete_tagged(const std::vector<bool>& _vertexTags,
+                                   const std::vector<bool>& _edgeTags,
+                                   const std::vector<bool>& _faceTags,
+                                   const std::vector<bool>& _cellTags,
+                                   HandleRemap* _remap) {
+
+    assert(_vertexTags.empty() || _vertexTags.size() == n_vertices());
+    assert(_edgeTags.empty() || _edgeTags.size() == n_edges());
+    assert(_faceTags.empty() || _faceTags.size() == n_faces());
+    assert(_cellTags.empty() || _cellTags.size() == n_cells());
+
+    // Propagate the tags from bottom to top
+    bool any = false;
+
+    std::vector<bool> vertexTags(n_vertices(), false);
+    for(size_t i = 0; i < vertexTags.size(); ++i) {
+        vertexTags[i] = vertex_deleted_[i] || (!_vertexTags.empty() && _vertexTags[i]);
+        any |= vertexTags[i];
+    }
+
+    std::vector<bool> edgeTags(n_edges(), false);
+    for(size_t i = 0; i < edgeTags.size(); ++i) {
+        const Edge& e = edges_[i];
+        edgeTags[i] = edge_deleted_[i] || (!_edgeTags.empty() && _edgeTags[i]) ||
+                vertexTags[e.from_vertex().idx()] || vertexTags[e.to_vertex().idx()];
+        any |= edgeTags[i];
+    }
+
+    std::vector<bool> faceTags(n_faces(), false);
+    for(size_t i = 0; i < faceTags.size(); ++i) {
+        bool tag = face_deleted_[i] || (!_faceTags.empty() && _faceTags[i]);
+        const size_t offset = face_offsets_[i];
+        for(size_t j = 0; j < face_valences_[i] && !tag; ++j) {
+            tag = edgeTags[face_halfedges_[offset + j].idx() / 2];
         }
+        faceTags[i] = tag;
+        any |= tag;
+    }
 
-    for (int i = (int)n_vertices(); i > 0; --i)
-        if (is_deleted(VertexHandle(i-1)))
-        {
-            vertex_deleted_[i-1] = false;
-            delete_vertex_core(VertexHandle(i-1));
+    std::vector<bool> cellTags(n_cells(), false);
+    for(size_t i = 0; i < cellTags.size(); ++i) {
+        bool tag = cell_deleted_[i] || (!_cellTags.empty() && _cellTags[i]);
+        const Cell::HalfFaceView hfs = cell(CellHandle((int)i)).halffaces();
+        for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
+                hf_end = hfs.end(); hf_it != hf_end && !tag; ++hf_it) {
+            tag = faceTags[hf_it->idx() / 2];
         }
+        cellTags[i] = tag;
+        any |= tag;
+    }
 
+    HandleRemap localRemap;
+    HandleRemap& remap = _remap ? *_remap : localRemap;
+    if(_remap || any) {
+        compute_new_indices(vertexTags, remap.vertices);
+        compute_new_indices(edgeTags, remap.edges);
+        compute_new_indices(faceTags, remap.faces);
+        compute_new_indices(cellTags, remap.cells);
+    }
 
-    deferred_deletion = true;
     needs_garbage_collection_ = false;
+    if(!any) return;
+
+    // All deleted entities are gone afterwards
+    free_vertices_.clear();
+    free_edges_.clear();
+    free_faces_.clear();
+    free_cells_.clear();
+
+    // Only the halfface cycles around edges of deleted faces and cells change
+    std::vector<int> reorderEdges;
+    if(e_bottom_up_ && f_bottom_up_) {
+        std::vector<bool> touched(edgeTags.size(), false);
+        for(size_t i = 0; i < faceTags.size(); ++i) {
+            if(!faceTags[i]) continue;
+            const size_t offset = face_offsets_[i];
+            for(size_t j = 0; j < face_valences_[i]; ++j) {
+                touched[face_halfedges_[offset + j].idx() / 2] = true;
+            }
+        }
+        for(size_t i = 0; i < cellTags.size(); ++i) {
+            if(!cellTags[i]) continue;
+            const Cell::HalfFaceView hfs = cell(CellHandle((int)i)).halffaces();
+            for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
+                    hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
+                const size_t fi = (size_t)hf_it->idx() / 2;
+                const size_t offset = face_offsets_[fi];
+                for(size_t j = 0; j < face_valences_[fi]; ++j) {
+                    touched[face_halfedges_[offset + j].idx() / 2] = true;
+                }
+            }
+        }
+        for(size_t i = 0; i < touched.size(); ++i) {
+            if(touched[i] && remap.edges[i] >= 0) reorderEdges.push_back(remap.edges[i]);
+        }
+    }
 
+    // The bottom-up incidences are left alone during the
+    // compaction and renumbered in place afterwards
+    const bool v_bu = v_bottom_up_;
+    const bool e_bu = e_bottom_up_;
+    const bool f_bu = f_bottom_up_;
+    v_bottom_up_ = e_bottom_up_ = f_bottom_up_ = false;
+
+    // Delete from top to bottom, so that no entity refers to a deleted one
+    delete_multiple_cells(cellTags);
+    delete_multiple_faces(faceTags);
+    delete_multiple_edges(edgeTags);
+    delete_multiple_vertices(vertexTags);
+
+    delete_multiple_bottom_up_incidences(vertexTags, edgeTags, remap, v_bu, e_bu, f_bu);
+    v_bottom_up_ = v_bu;
+    e_bottom_up_ = e_bu;
+    f_bottom_up_ = f_bu;
+
+    if(f_bu) {
+        std::vector<HalfFaceHandle> forward, backward;
+        for(size_t i = 0; i < reorderEdges.size(); ++i) {
+            // Start from the same order as a recomputation
+            for(int k = 0; k < 2; ++k) {
+                IncidenceArray<HalfFaceHandle>::Row hfs = incident_hfs_per_he_[2 * reorderEdges[i] + k];
+                std::sort(hfs.begin(), hfs.end());
+            }
+            reorder_incident_halffaces(EdgeHandle(reorderEdges[i]), forward, backward);
+        }
+        if(boundary_index_enabled_) {
+            compute_boundary_index();
+        }
+        if(cell_neighbor_table_enabled_) {
+            compute_cell_neighbor_table();
+        }
+    }
 }
 
 //========================================================================================
@@ -772,9 +1677,10 @@ void TopologyKernel::get_incident_edges(const ContainerT& _vs,
         for(typename ContainerT::const_iterator v_it = _vs.begin(),
                 v_end = _vs.end(); v_it != v_end; ++v_it) {
 
-            const std::vector<HalfEdgeHandle>& inc_hes = outgoing_hes_per_vertex_[v_it->idx()];
+            const IncidenceArray<HalfEdgeHandle>& outgoing = outgoing_hes_per_vertex_;
+            ConstArrayView<HalfEdgeHandle> inc_hes = outgoing[v_it->idx()];
 
-            for(std::vector<HalfEdgeHandle>::const_iterator he_it = inc_hes.begin(),
+            for(ConstArrayView<HalfEdgeHandle>::const_iterator he_it = inc_hes.begin(),
                     he_end = inc_hes.end(); he_it != he_end; ++he_it) {
 
                 _es.insert(edge_handle(*he_it));
@@ -828,9 +1734,9 @@ void TopologyKernel::get_incident_faces(const ContainerT& _es,
             for(FaceIter f_it = faces_begin(),
                     f_end = faces_end(); f_it != f_end; ++f_it) {
 
-                const std::vector<HalfEdgeHandle>& hes = face(*f_it).halfedges();
+                const Face::HalfEdgeView hes = face(*f_it).halfedges();
 
-                for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin(),
+                for(Face::HalfEdgeView::const_iterator he_it = hes.begin(),
                         he_end = hes.end(); he_it != he_end; ++he_it) {
 
                     if(edge_handle(*he_it) == *e_it) {
@@ -873,9 +1779,9 @@ void TopologyKernel::get_incident_cells(const ContainerT& _fs,
             for(CellIter c_it = cells_begin(), c_end = cells_end();
                 c_it != c_end; ++c_it) {
 
-                const std::vector<HalfFaceHandle>& hfs = cell(*c_it).halffaces();
+                const Cell::HalfFaceView hfs = cell(*c_it).halffaces();
 
-                for(std::vector<HalfFaceHandle>::const_iterator hf_it = hfs.begin(),
+                for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
                         hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
 
                     if(face_handle(*hf_it) == *f_it) {
@@ -923,7 +1829,10 @@ VertexIter TopologyKernel::delete_vertex_core(const VertexHandle& _h) {
     if (deferred_deletion_enabled())
     {
         needs_garbage_collection_ = true;
-        vertex_deleted_[h.idx()] = true;
+        if(slot_reuse_enabled_ && !vertex_deleted_[h.idx()]) {
+            free_vertices_.push_back(h.idx());
+        }
+        vertex_deleted_.set(h.idx(), true);
 //        deleted_vertices_.push_back(h);
 
         // Iterator to next element in vertex list
@@ -937,8 +1846,9 @@ VertexIter TopologyKernel::delete_vertex_core(const VertexHandle& _h) {
 
             // Decrease all vertex handles >= _h in all edge definitions
             for(int i = h.idx(), end = (int)n_vertices(); i < end; ++i) {
-                const std::vector<HalfEdgeHandle>& hes = outgoing_hes_per_vertex_[i];
-                for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin(),
+                const IncidenceArray<HalfEdgeHandle>& outgoing = outgoing_hes_per_vertex_;
+                ConstArrayView<HalfEdgeHandle> hes = outgoing[i];
+                for(ConstArrayView<HalfEdgeHandle>::const_iterator he_it = hes.begin(),
                     he_end = hes.end(); he_it != he_end; ++he_it) {
 
                     Edge& e = edge(edge_handle(*he_it));
@@ -971,14 +1881,34 @@ VertexIter TopologyKernel::delete_vertex_core(const VertexHandle& _h) {
 
         if(v_bottom_up_) {
             assert((size_t)h.idx() < outgoing_hes_per_vertex_.size());
-            outgoing_hes_per_vertex_.erase(outgoing_hes_per_vertex_.begin() + h.idx());
+            outgoing_hes_per_vertex_.erase_row(h.idx());
+        }
+        if(vc_incidences_enabled_) {
+            assert((size_t)h.idx() < incident_cells_per_vertex_.size());
+            incident_cells_per_vertex_.erase_row(h.idx());
+        }
+        if(boundary_index_valid()) {
+            assert((size_t)h.idx() < n_boundary_faces_per_vertex_.size());
+            n_boundary_faces_per_vertex_.erase(n_boundary_faces_per_vertex_.begin() + h.idx());
         }
 
 
         // 3)
 
         --n_vertices_;
-        vertex_deleted_.erase(vertex_deleted_.begin() + h.idx());
+        vertex_deleted_.erase(h.idx());
+
+        // Vertex handles of edges, faces and cells have changed
+        if((size_t)h.idx() < n_vertices_) {
+            if(edge_index_enabled_) compute_edge_index();
+            if(face_index_enabled_) compute_face_index();
+            if(cell_vertex_table_enabled_) {
+                for(std::vector<int>::iterator it = cell_vertex_table_.begin(),
+                        end = cell_vertex_table_.end(); it != end; ++it) {
+                    if(*it > h.idx()) --(*it);
+                }
+            }
+        }
 
         // 4)
 
@@ -1051,7 +1981,14 @@ EdgeIter TopologyKernel::delete_edge_core(const EdgeHandle& _h) {
     if (deferred_deletion_enabled())
     {
         needs_garbage_collection_ = true;
-        edge_deleted_[h.idx()] = true;
+        if(slot_reuse_enabled_ && !edge_deleted_[h.idx()]) {
+            // The slot will be indexed again with its new vertices
+            if(edge_index_enabled_) {
+                edge_index_.erase(edge_hash(edges_[h.idx()].from_vertex(), edges_[h.idx()].to_vertex()), h.idx());
+            }
+            free_edges_.push_back(h.idx());
+        }
+        edge_deleted_.set(h.idx(), true);
 //        deleted_edges_.push_back(h);
 
         // Return iterator to next element in list
@@ -1072,11 +2009,11 @@ EdgeIter TopologyKernel::delete_edge_core(const EdgeHandle& _h) {
                 // delete all half-edge handles == he in face definitions
                 // Get all faces that need updates
                 std::set<FaceHandle> update_faces;
-                for(std::vector<std::vector<HalfFaceHandle> >::const_iterator iit =
-                    (incident_hfs_per_he_.begin() + halfedge_handle(h, 0).idx()),
-                    iit_end = incident_hfs_per_he_.end(); iit != iit_end; ++iit) {
-                    for(std::vector<HalfFaceHandle>::const_iterator it = iit->begin(),
-                        end = iit->end(); it != end; ++it) {
+                const IncidenceArray<HalfFaceHandle>& incident = incident_hfs_per_he_;
+                for(size_t i = halfedge_handle(h, 0).idx(); i < incident.size(); ++i) {
+                    ConstArrayView<HalfFaceHandle> hfs = incident[i];
+                    for(ConstArrayView<HalfFaceHandle>::const_iterator it = hfs.begin(),
+                        end = hfs.end(); it != end; ++it) {
                         update_faces.insert(face_handle(*it));
                     }
                 }
@@ -1100,7 +2037,7 @@ EdgeIter TopologyKernel::delete_edge_core(const EdgeHandle& _h) {
                     std::for_each(hes.begin(), hes.end(),
                                   fun::bind(&HEHandleCorrection::correctValue, &cor, fun::placeholders::_1));
     #endif
-                    face(*f_it).set_halfedges(hes);
+                    store_face_halfedges(*f_it, hes);
                 }
             } else {
 
@@ -1126,7 +2063,7 @@ EdgeIter TopologyKernel::delete_edge_core(const EdgeHandle& _h) {
                     std::for_each(hes.begin(), hes.end(),
                                   fun::bind(&HEHandleCorrection::correctValue, &cor, fun::placeholders::_1));
     #endif
-                    face(*f_it).set_halfedges(hes);
+                    store_face_halfedges(*f_it, hes);
                 }
             }
         }
@@ -1136,8 +2073,8 @@ EdgeIter TopologyKernel::delete_edge_core(const EdgeHandle& _h) {
         if(e_bottom_up_) {
             assert((size_t)halfedge_handle(h, 1).idx() < incident_hfs_per_he_.size());
 
-            incident_hfs_per_he_.erase(incident_hfs_per_he_.begin() + halfedge_handle(h, 1).idx());
-            incident_hfs_per_he_.erase(incident_hfs_per_he_.begin() + halfedge_handle(h, 0).idx());
+            incident_hfs_per_he_.erase_row(halfedge_handle(h, 1).idx());
+            incident_hfs_per_he_.erase_row(halfedge_handle(h, 0).idx());
         }
 
         if (!fast_deletion_enabled())
@@ -1146,22 +2083,34 @@ EdgeIter TopologyKernel::delete_edge_core(const EdgeHandle& _h) {
             if(v_bottom_up_) {
                 HEHandleCorrection cor(halfedge_handle(h, 1));
     #if defined(__clang_major__) && (__clang_major__ >= 5)
-                for(std::vector<std::vector<HalfEdgeHandle> >::iterator it = outgoing_hes_per_vertex_.begin(),
-                    end = outgoing_hes_per_vertex_.end(); it != end; ++it) {
-                    cor.correctVecValue(*it);
+                for(HalfEdgeHandle* it = outgoing_hes_per_vertex_.elements_begin(),
+                    *end = outgoing_hes_per_vertex_.elements_end(); it != end; ++it) {
+                    cor.correctValue(*it);
                 }
     #else
-                std::for_each(outgoing_hes_per_vertex_.begin(),
-                              outgoing_hes_per_vertex_.end(),
-                              fun::bind(&HEHandleCorrection::correctVecValue, &cor, fun::placeholders::_1));
+                std::for_each(outgoing_hes_per_vertex_.elements_begin(),
+                              outgoing_hes_per_vertex_.elements_end(),
+                              fun::bind(&HEHandleCorrection::correctValue, &cor, fun::placeholders::_1));
     #endif
             }
         }
 
 
         // 5)
+        if(edge_index_enabled_) {
+            edge_index_.erase(edge_hash(edges_[h.idx()].from_vertex(), edges_[h.idx()].to_vertex()), h.idx());
+        }
+
         edges_.erase(edges_.begin() + h.idx());
-        edge_deleted_.erase(edge_deleted_.begin() + h.idx());
+        edge_deleted_.erase(h.idx());
+        if(boundary_index_valid()) {
+            n_boundary_faces_per_edge_.erase(n_boundary_faces_per_edge_.begin() + h.idx());
+        }
+
+        // Handles of the following edges have changed
+        if(edge_index_enabled_ && (size_t)h.idx() < edges_.size()) {
+            compute_edge_index();
+        }
 
 
         // 6)
@@ -1200,22 +2149,26 @@ FaceIter TopologyKernel::delete_face_core(const FaceHandle& _h) {
 
     FaceHandle h = _h;
 
-    assert(h.is_valid() && (size_t)h.idx() < faces_.size());
+    assert(h.is_valid() && (size_t)h.idx() < face_offsets_.size());
 
 
     if (fast_deletion_enabled() && !deferred_deletion_enabled()) // for fast deletion swap handle with last one
     {
-        FaceHandle last_face = FaceHandle((int)faces_.size()-1);
+        FaceHandle last_face = FaceHandle((int)face_offsets_.size()-1);
         assert(!face_deleted_[last_face.idx()]);
         swap_faces(h, last_face);
         h = last_face;
     }
 
+    if(boundary_index_valid()) {
+        set_boundary_face(h, false);
+    }
+
     // 1)
     if(e_bottom_up_) {
 
-        const std::vector<HalfEdgeHandle>& hes = face(h).halfedges();
-        for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin(),
+        const Face::HalfEdgeView hes = face(h).halfedges();
+        for(Face::HalfEdgeView::const_iterator he_it = hes.begin(),
                 he_end = hes.end(); he_it != he_end; ++he_it) {
 
             assert((size_t)std::max(he_it->idx(), opposite_halfedge_handle(*he_it).idx()) < incident_hfs_per_he_.size());
@@ -1236,7 +2189,14 @@ FaceIter TopologyKernel::delete_face_core(const FaceHandle& _h) {
     if (deferred_deletion_enabled())
     {
         needs_garbage_collection_ = true;
-        face_deleted_[h.idx()] = true;
+        if(slot_reuse_enabled_ && !face_deleted_[h.idx()]) {
+            // The slot will be indexed again with its new vertices
+            if(face_index_enabled_) {
+                face_index_.erase(face_hash(h), h.idx());
+            }
+            free_faces_.push_back(h.idx());
+        }
+        face_deleted_.set(h.idx(), true);
 //        deleted_faces_.push_back(h);
 
         // Return iterator to next element in list
@@ -1278,7 +2238,7 @@ FaceIter TopologyKernel::delete_face_core(const FaceHandle& _h) {
                     std::for_each(hfs.begin(), hfs.end(),
                                   fun::bind(&HFHandleCorrection::correctValue, &cor, fun::placeholders::_1));
 #endif
-                    cell(*c_it).set_halffaces(hfs);
+                    store_cell_halffaces(*c_it, hfs);
                 }
 
             } else {
@@ -1302,7 +2262,7 @@ FaceIter TopologyKernel::delete_face_core(const FaceHandle& _h) {
                     std::for_each(hfs.begin(), hfs.end(),
                                   fun::bind(&HFHandleCorrection::correctValue, &cor, fun::placeholders::_1));
 #endif
-                    cell(*c_it).set_halffaces(hfs);
+                    store_cell_halffaces(*c_it, hfs);
                 }
             }
         }
@@ -1323,20 +2283,42 @@ FaceIter TopologyKernel::delete_face_core(const FaceHandle& _h) {
             if(e_bottom_up_) {
                 HFHandleCorrection cor(halfface_handle(h, 1));
 #if defined(__clang_major__) && (__clang_major__ >= 5)
-                for(std::vector<std::vector<HalfFaceHandle> >::iterator it = incident_hfs_per_he_.begin(), end = incident_hfs_per_he_.end(); it != end; ++it) {
-                    cor.correctVecValue(*it);
+                for(HalfFaceHandle* it = incident_hfs_per_he_.elements_begin(),
+                    *end = incident_hfs_per_he_.elements_end(); it != end; ++it) {
+                    cor.correctValue(*it);
                 }
 #else
-                std::for_each(incident_hfs_per_he_.begin(),
-                              incident_hfs_per_he_.end(),
-                              fun::bind(&HFHandleCorrection::correctVecValue, &cor, fun::placeholders::_1));
+                std::for_each(incident_hfs_per_he_.elements_begin(),
+                              incident_hfs_per_he_.elements_end(),
+                              fun::bind(&HFHandleCorrection::correctValue, &cor, fun::placeholders::_1));
 #endif
             }
         }
 
         // 5)
-        faces_.erase(faces_.begin() + h.idx());
-        face_deleted_.erase(face_deleted_.begin() + h.idx());
+        if(face_index_enabled_) {
+            face_index_.erase(face_hash(h), h.idx());
+        }
+
+        const size_t offset = face_offsets_[h.idx()];
+        const size_t valence = face_valences_[h.idx()];
+        face_offsets_.erase(face_offsets_.begin() + h.idx());
+        face_valences_.erase(face_valences_.begin() + h.idx());
+        face_deleted_.erase(h.idx());
+        release_face_halfedges(offset, valence);
+
+        if(boundary_index_valid()) {
+            boundary_face_pos_.erase(boundary_face_pos_.begin() + h.idx());
+            for(std::vector<FaceHandle>::iterator it = boundary_faces_.begin(),
+                    end = boundary_faces_.end(); it != end; ++it) {
+                if(*it > h) *it = FaceHandle(it->idx() - 1);
+            }
+        }
+
+        // Handles of the following faces have changed
+        if(face_index_enabled_ && (size_t)h.idx() < face_offsets_.size()) {
+            compute_face_index();
+        }
 
         // 6)
         face_deleted(h);
@@ -1369,12 +2351,12 @@ CellIter TopologyKernel::delete_cell_core(const CellHandle& _h) {
 
     CellHandle h = _h;
 
-    assert(h.is_valid() && (size_t)h.idx() < cells_.size());
+    assert(h.is_valid() && (size_t)h.idx() < n_cells());
 
 
     if (fast_deletion_enabled() && !deferred_deletion_enabled()) // for fast deletion swap handle with last not deleted cell
     {
-        CellHandle last_undeleted_cell = CellHandle((int)cells_.size()-1);
+        CellHandle last_undeleted_cell = CellHandle((int)n_cells()-1);
         assert(!cell_deleted_[last_undeleted_cell.idx()]);
         swap_cells(h, last_undeleted_cell);
         h = last_undeleted_cell;
@@ -1383,19 +2365,35 @@ CellIter TopologyKernel::delete_cell_core(const CellHandle& _h) {
 
     // 1)
     if(f_bottom_up_) {
-        const std::vector<HalfFaceHandle>& hfs = cell(h).halffaces();
-        for(std::vector<HalfFaceHandle>::const_iterator hf_it = hfs.begin(),
+        const Cell::HalfFaceView hfs = cell(h).halffaces();
+        for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
                 hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
             assert((size_t)hf_it->idx() < incident_cell_per_hf_.size());
             if (incident_cell_per_hf_[hf_it->idx()] == h)
                 incident_cell_per_hf_[hf_it->idx()] = InvalidCellHandle;
         }
     }
+    if(vc_incidences_enabled_) {
+        remove_vertex_cell_incidences(h);
+    }
+    if(boundary_index_valid()) {
+        const Cell::HalfFaceView hfs = cell(h).halffaces();
+        for(Cell::HalfFaceView::const_iterator hf_it = hfs.begin(),
+                hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
+            update_boundary_face(face_handle(*hf_it));
+        }
+    }
+    if(cell_neighbor_table_valid()) {
+        update_cell_neighbors(h);
+    }
 
     if (deferred_deletion_enabled())
     {
         needs_garbage_collection_ = true;
-        cell_deleted_[h.idx()] = true;
+        if(slot_reuse_enabled_ && !cell_deleted_[h.idx()]) {
+            free_cells_.push_back(h.idx());
+        }
+        cell_deleted_.set(h.idx(), true);
 //        deleted_cells_.push_back(h);
 //        deleted_cells_set.insert(h);
 
@@ -1420,11 +2418,41 @@ CellIter TopologyKernel::delete_cell_core(const CellHandle& _h) {
                               fun::bind(&CHandleCorrection::correctValue, &cor, fun::placeholders::_1));
 #endif
             }
+            if(vc_incidences_enabled_) {
+                CHandleCorrection cor(h);
+                for(CellHandle* it = incident_cells_per_vertex_.elements_begin(),
+                    *end = incident_cells_per_vertex_.elements_end(); it != end; ++it) {
+                    cor.correctValue(*it);
+                }
+            }
+            if(cell_neighbor_table_valid()) {
+                for(std::vector<int>::iterator it = cell_neighbor_table_.begin(),
+                        end = cell_neighbor_table_.end(); it != end; ++it) {
+                    if(*it > h.idx()) --(*it);
+                }
+            }
         }
 
         // 3)
-        cells_.erase(cells_.begin() + h.idx());
-        cell_deleted_.erase(cell_deleted_.begin() + h.idx());
+        const size_t offset = cell_offset(h);
+        const size_t valence = this->valence(h);
+        if(fixed_cell_valence_ == 0u) {
+            cell_offsets_.erase(cell_offsets_.begin() + h.idx());
+            cell_valences_.erase(cell_valences_.begin() + h.idx());
+        }
+        cell_deleted_.erase(h.idx());
+        release_cell_halffaces(offset, valence);
+        if(hf_adjacency_enabled_) {
+            adjacent_hf_per_cell_.erase_row(h.idx());
+        }
+        if(cell_neighbor_table_valid()) {
+            cell_neighbor_table_.erase(cell_neighbor_table_.begin() + (size_t)h.idx() * fixed_cell_valence_,
+                                       cell_neighbor_table_.begin() + (size_t)(h.idx() + 1) * fixed_cell_valence_);
+        }
+        if(cell_vertex_table_enabled_) {
+            cell_vertex_table_.erase(cell_vertex_table_.begin() + (size_t)h.idx() * n_vertices_per_cell_,
+                                     cell_vertex_table_.begin() + (size_t)(h.idx() + 1) * n_vertices_per_cell_);
+        }
 
         // 4)
         cell_deleted(h);
@@ -1437,8 +2465,8 @@ CellIter TopologyKernel::delete_cell_core(const CellHandle& _h) {
 
 void TopologyKernel::swap_cells(CellHandle _h1, CellHandle _h2)
 {
-    assert(_h1.idx() >= 0 && _h1.idx() < (int)cells_.size());
-    assert(_h2.idx() >= 0 && _h2.idx() < (int)cells_.size());
+    assert(_h1.idx() >= 0 && _h1.idx() < (int)n_cells());
+    assert(_h2.idx() >= 0 && _h2.idx() < (int)n_cells());
 
     if (_h1 == _h2)
         return;
@@ -1446,11 +2474,8 @@ void TopologyKernel::swap_cells(CellHandle _h1, CellHandle _h2)
     int id1 = _h1.idx();
     int id2 = _h2.idx();
 
-    Cell c1 = cells_[id1];
-    Cell c2 = cells_[id2];
-
     // correct pointers to those cells
-    std::vector<HalfFaceHandle> hfhs1 = c1.halffaces();
+    const Cell::HalfFaceView hfhs1 = cell(_h1).halffaces();
     for (unsigned int i = 0; i < hfhs1.size(); ++i)
     {
         HalfFaceHandle hfh = hfhs1[i];
@@ -1458,7 +2483,7 @@ void TopologyKernel::swap_cells(CellHandle _h1, CellHandle _h2)
             incident_cell_per_hf_[hfh.idx()] = id2;
     }
 
-    std::vector<HalfFaceHandle> hfhs2 = c2.halffaces();
+    const Cell::HalfFaceView hfhs2 = cell(_h2).halffaces();
     for (unsigned int i = 0; i < hfhs2.size(); ++i)
     {
         HalfFaceHandle hfh = hfhs2[i];
@@ -1466,18 +2491,53 @@ void TopologyKernel::swap_cells(CellHandle _h1, CellHandle _h2)
             incident_cell_per_hf_[hfh.idx()] = id1;
     }
 
+    if(vc_incidences_enabled_) {
+        // Visit the vertices shared by both cells only once
+        CellVertexSet vs, vs2;
+        get_cell_vertex_set(_h1, vs);
+        get_cell_vertex_set(_h2, vs2);
+        for(CellVertexSet::const_iterator v_it = vs2.begin(); v_it != vs2.end(); ++v_it) {
+            vs.insert_sorted_unique(*v_it);
+        }
+        for(CellVertexSet::const_iterator v_it = vs.begin(); v_it != vs.end(); ++v_it) {
+            IncidenceArray<CellHandle>::Row cells = incident_cells_per_vertex_[v_it->idx()];
+            for(CellHandle* c_it = cells.begin(); c_it != cells.end(); ++c_it) {
+                if(*c_it == _h1) *c_it = _h2;
+                else if(*c_it == _h2) *c_it = _h1;
+            }
+        }
+    }
+
     // swap vector entries
-    std::swap(cells_[id1], cells_[id2]);
-    bool tmp = cell_deleted_[id1];
-    cell_deleted_[id1] = cell_deleted_[id2];
-    cell_deleted_[id2] = tmp;
+    if(fixed_cell_valence_ != 0u) {
+        std::swap_ranges(cell_halffaces_begin(_h1), cell_halffaces_begin(_h1) + fixed_cell_valence_,
+                         cell_halffaces_begin(_h2));
+    } else {
+        std::swap(cell_offsets_[id1], cell_offsets_[id2]);
+        std::swap(cell_valences_[id1], cell_valences_[id2]);
+    }
+    cell_deleted_.swap(id1, id2);
+    if(hf_adjacency_enabled_) {
+        adjacent_hf_per_cell_.swap_rows(id1, id2);
+    }
+    if(cell_vertex_table_enabled_) {
+        std::swap_ranges(cell_vertex_table_.begin() + (size_t)id1 * n_vertices_per_cell_,
+                         cell_vertex_table_.begin() + (size_t)(id1 + 1) * n_vertices_per_cell_,
+                         cell_vertex_table_.begin() + (size_t)id2 * n_vertices_per_cell_);
+    }
     swap_cell_properties(_h1, _h2);
+
+    // The neighbors of both cells refer to the other handle now
+    if(cell_neighbor_table_valid()) {
+        update_cell_neighbors(_h1);
+        update_cell_neighbors(_h2);
+    }
 }
 
 void TopologyKernel::swap_faces(FaceHandle _h1, FaceHandle _h2)
 {
-    assert(_h1.idx() >= 0 && _h1.idx() < (int)faces_.size());
-    assert(_h2.idx() >= 0 && _h2.idx() < (int)faces_.size());
+    assert(_h1.idx() >= 0 && _h1.idx() < (int)face_offsets_.size());
+    assert(_h2.idx() >= 0 && _h2.idx() < (int)face_offsets_.size());
 
     if (_h1 == _h2)
         return;
@@ -1511,19 +2571,14 @@ void TopologyKernel::swap_faces(FaceHandle _h1, FaceHandle _h2)
                 if (processed_cells.find(ch.idx()) == processed_cells.end())
                 {
 
-                    Cell& c = cells_[ch.idx()];
-
                     // replace old halffaces with new halffaces where the ids are swapped
 
-                    std::vector<HalfFaceHandle> new_halffaces;
-                    for (unsigned int k = 0; k < c.halffaces().size(); ++k)
-                        if (c.halffaces()[k].idx()/2 == (int)id1) // if halfface belongs to swapped face
-                            new_halffaces.push_back(HalfFaceHandle(2 * id2 + (c.halffaces()[k].idx() % 2)));
-                        else if (c.halffaces()[k].idx()/2 == (int)id2) // if halfface belongs to swapped face
-                            new_halffaces.push_back(HalfFaceHandle(2 * id1 + (c.halffaces()[k].idx() % 2)));
-                        else
-                            new_halffaces.push_back(c.halffaces()[k]);
-                    c.set_halffaces(new_halffaces);
+                    HalfFaceHandle* hfs = cell_halffaces_begin(ch);
+                    for (unsigned int k = 0; k < valence(ch); ++k)
+                        if (hfs[k].idx()/2 == (int)id1) // if halfface belongs to swapped face
+                            hfs[k] = HalfFaceHandle(2 * id2 + (hfs[k].idx() % 2));
+                        else if (hfs[k].idx()/2 == (int)id2) // if halfface belongs to swapped face
+                            hfs[k] = HalfFaceHandle(2 * id1 + (hfs[k].idx() % 2));
 
                     processed_cells.insert(ch.idx());
                 }
@@ -1533,35 +2588,15 @@ void TopologyKernel::swap_faces(FaceHandle _h1, FaceHandle _h2)
     else
     {
         // serach for all cells that contain a swapped face
-        for (unsigned int i = 0; i < cells_.size(); ++i)
+        for (unsigned int i = 0; i < n_cells(); ++i)
         {
-            Cell& c = cells_[i];
-
-            // check if c contains a swapped face
-            bool contains_swapped_face = false;
-            for (unsigned int k = 0; k < c.halffaces().size(); ++k)
-            {
-                if (c.halffaces()[k].idx()/2 == (int)id1)
-                    contains_swapped_face = true;
-                if (c.halffaces()[k].idx()/2 == (int)id2)
-                    contains_swapped_face = true;
-                if (contains_swapped_face)
-                    break;
-            }
-
-            if (contains_swapped_face)
-            {
             // replace old halffaces with new halffaces where the ids are swapped
-                std::vector<HalfFaceHandle> new_halffaces;
-                for (unsigned int k = 0; k < c.halffaces().size(); ++k)
-                    if (c.halffaces()[k].idx()/2 == (int)id1) // if halfface belongs to swapped face
-                        new_halffaces.push_back(HalfFaceHandle(2 * id2 + (c.halffaces()[k].idx() % 2)));
-                    else if (c.halffaces()[k].idx()/2 == (int)id2) // if halfface belongs to swapped face
-                        new_halffaces.push_back(HalfFaceHandle(2 * id1 + (c.halffaces()[k].idx() % 2)));
-                    else
-                        new_halffaces.push_back(c.halffaces()[k]);
-                c.set_halffaces(new_halffaces);
-            }
+            HalfFaceHandle* hfs = cell_halffaces_begin(CellHandle(i));
+            for (unsigned int k = 0; k < valence(CellHandle(i)); ++k)
+                if (hfs[k].idx()/2 == (int)id1) // if halfface belongs to swapped face
+                    hfs[k] = HalfFaceHandle(2 * id2 + (hfs[k].idx() % 2));
+                else if (hfs[k].idx()/2 == (int)id2) // if halfface belongs to swapped face
+                    hfs[k] = HalfFaceHandle(2 * id1 + (hfs[k].idx() % 2));
         }
     }
 
@@ -1585,7 +2620,7 @@ void TopologyKernel::swap_faces(FaceHandle _h1, FaceHandle _h2)
                     if (processed_halfedges.find(heh.idx()) != processed_halfedges.end())
                         continue;
 
-                    std::vector<HalfFaceHandle>& incident_halffaces = incident_hfs_per_he_[heh.idx()];
+                    IncidenceArray<HalfFaceHandle>::Row incident_halffaces = incident_hfs_per_he_[heh.idx()];
                     for (unsigned int l = 0; l < incident_halffaces.size(); ++l)
                     {
                         HalfFaceHandle& hfh2 = incident_halffaces[l];
@@ -1602,13 +2637,29 @@ void TopologyKernel::swap_faces(FaceHandle _h1, FaceHandle _h2)
         }
     }
 
+    if(face_index_enabled_) {
+        face_index_.erase(face_hash(_h1), _h1.idx());
+        face_index_.erase(face_hash(_h2), _h2.idx());
+        face_index_.insert(face_hash(_h1), _h2.idx());
+        face_index_.insert(face_hash(_h2), _h1.idx());
+    }
+
     // swap vector entries
-    std::swap(faces_[ids[0]], faces_[ids[1]]);
-    bool tmp = face_deleted_[ids[0]];
-    face_deleted_[ids[0]] = face_deleted_[ids[1]];
-    face_deleted_[ids[1]] = tmp;
-    std::swap(incident_cell_per_hf_[2*ids[0]+0], incident_cell_per_hf_[2*ids[1]+0]);
-    std::swap(incident_cell_per_hf_[2*ids[0]+1], incident_cell_per_hf_[2*ids[1]+1]);
+    std::swap(face_offsets_[ids[0]], face_offsets_[ids[1]]);
+    std::swap(face_valences_[ids[0]], face_valences_[ids[1]]);
+    face_deleted_.swap(ids[0], ids[1]);
+    if (has_face_bottom_up_incidences())
+    {
+        std::swap(incident_cell_per_hf_[2*ids[0]+0], incident_cell_per_hf_[2*ids[1]+0]);
+        std::swap(incident_cell_per_hf_[2*ids[0]+1], incident_cell_per_hf_[2*ids[1]+1]);
+    }
+    if (boundary_index_valid())
+    {
+        std::swap(boundary_face_pos_[ids[0]], boundary_face_pos_[ids[1]]);
+        for (unsigned int i = 0; i < 2; ++i)
+            if (boundary_face_pos_[ids[i]] >= 0)
+                boundary_faces_[boundary_face_pos_[ids[i]]] = FaceHandle(ids[i]);
+    }
     swap_face_properties(_h1, _h2);
     swap_halfface_properties(halfface_handle(_h1, 0), halfface_handle(_h2, 0));
     swap_halfface_properties(halfface_handle(_h1, 1), halfface_handle(_h2, 1));
@@ -1639,7 +2690,7 @@ void TopologyKernel::swap_edges(EdgeHandle _h1, EdgeHandle _h2)
             HalfEdgeHandle heh = HalfEdgeHandle(2*ids[i]);
 
 
-            std::vector<HalfFaceHandle>& incident_halffaces = incident_hfs_per_he_[heh.idx()];
+            IncidenceArray<HalfFaceHandle>::Row incident_halffaces = incident_hfs_per_he_[heh.idx()];
             for (unsigned int j = 0; j < incident_halffaces.size(); ++j) // for each incident halfface
             {
                 HalfFaceHandle hfh = incident_halffaces[j];
@@ -1649,21 +2700,16 @@ void TopologyKernel::swap_edges(EdgeHandle _h1, EdgeHandle _h2)
                 if (processed_faces.find(f_id) == processed_faces.end())
                 {
 
-                    Face& f = faces_[f_id];
-
                     // replace old incident halfedges with new incident halfedges where the ids are swapped
-                    std::vector<HalfEdgeHandle> new_halfedges;
-                    for (unsigned int k = 0; k < f.halfedges().size(); ++k)
+                    HalfEdgeHandle* hes = face_halfedges_begin(FaceHandle(f_id));
+                    for (unsigned int k = 0; k < face_valences_[f_id]; ++k)
                     {
-                        HalfEdgeHandle heh2 = f.halfedges()[k];
+                        HalfEdgeHandle& heh2 = hes[k];
                         if (heh2.idx() / 2 == (int)ids[0])
-                            new_halfedges.push_back(HalfEdgeHandle(2*ids[1] + (heh2.idx() % 2)));
+                            heh2 = HalfEdgeHandle(2*ids[1] + (heh2.idx() % 2));
                         else if (heh2.idx() / 2 == (int)ids[1])
-                            new_halfedges.push_back(HalfEdgeHandle(2*ids[0] + (heh2.idx() % 2)));
-                        else
-                            new_halfedges.push_back(heh2);
+                            heh2 = HalfEdgeHandle(2*ids[0] + (heh2.idx() % 2));
                     }
-                    f.set_halfedges(new_halfedges);
 
                     processed_faces.insert(f_id);
                 }
@@ -1673,37 +2719,17 @@ void TopologyKernel::swap_edges(EdgeHandle _h1, EdgeHandle _h2)
     else
     {
         // search for all faces that contain one of the swapped edges
-        for (unsigned int i = 0; i < faces_.size(); ++i)
+        // and replace old incident halfedges with new incident halfedges where the ids are swapped
+        for (unsigned int i = 0; i < face_offsets_.size(); ++i)
         {
-            Face& f = faces_[i];
-
-            // check if f contains a swapped edge
-            bool contains_swapped_edge = false;
-            for (unsigned int k = 0; k < f.halfedges().size(); ++k)
-            {
-                if (f.halfedges()[k].idx()/2 == (int)ids[0])
-                    contains_swapped_edge = true;
-                if (f.halfedges()[k].idx()/2 == (int)ids[1])
-                    contains_swapped_edge = true;
-                if (contains_swapped_edge)
-                    break;
-            }
-
-            if (contains_swapped_edge)
+            HalfEdgeHandle* hes = face_halfedges_begin(FaceHandle(i));
+            for (unsigned int k = 0; k < face_valences_[i]; ++k)
             {
-                // replace old incident halfedges with new incident halfedges where the ids are swapped
-                std::vector<HalfEdgeHandle> new_halfedges;
-                for (unsigned int k = 0; k < f.halfedges().size(); ++k)
-                {
-                    HalfEdgeHandle heh2 = f.halfedges()[k];
-                    if (heh2.idx() / 2 == (int)ids[0])
-                        new_halfedges.push_back(HalfEdgeHandle(2*ids[1] + (heh2.idx() % 2)));
-                    else if (heh2.idx() / 2 == (int)ids[1])
-                        new_halfedges.push_back(HalfEdgeHandle(2*ids[0] + (heh2.idx() % 2)));
-                    else
-                        new_halfedges.push_back(heh2);
-                }
-                f.set_halfedges(new_halfedges);
+                HalfEdgeHandle& heh2 = hes[k];
+                if (heh2.idx() / 2 == (int)ids[0])
+                    heh2 = HalfEdgeHandle(2*ids[1] + (heh2.idx() % 2));
+                else if (heh2.idx() / 2 == (int)ids[1])
+                    heh2 = HalfEdgeHandle(2*ids[0] + (heh2.idx() % 2));
             }
         }
     }
@@ -1725,7 +2751,7 @@ void TopologyKernel::swap_edges(EdgeHandle _h1, EdgeHandle _h2)
                 if (processed_vertices.find(vhs[j].idx()) != processed_vertices.end())
                     continue;
 
-                std::vector<HalfEdgeHandle>& outgoing_hes = outgoing_hes_per_vertex_[vhs[j].idx()];
+                IncidenceArray<HalfEdgeHandle>::Row outgoing_hes = outgoing_hes_per_vertex_[vhs[j].idx()];
                 for (unsigned int k = 0; k < outgoing_hes.size(); ++k)
                 {
                     HalfEdgeHandle& heh = outgoing_hes[k];
@@ -1740,13 +2766,25 @@ void TopologyKernel::swap_edges(EdgeHandle _h1, EdgeHandle _h2)
         }
     }
 
+    if(edge_index_enabled_) {
+        for(unsigned int i = 0; i < 2; ++i) {
+            edge_index_.erase(edge_hash(edges_[ids[i]].from_vertex(), edges_[ids[i]].to_vertex()), ids[i]);
+        }
+        for(unsigned int i = 0; i < 2; ++i) {
+            edge_index_.insert(edge_hash(edges_[ids[1 - i]].from_vertex(), edges_[ids[1 - i]].to_vertex()), ids[i]);
+        }
+    }
+
     // swap vector entries
     std::swap(edges_[ids[0]], edges_[ids[1]]);
-    bool tmp = edge_deleted_[ids[0]];
-    edge_deleted_[ids[0]] = edge_deleted_[ids[1]];
-    edge_deleted_[ids[1]] = tmp;
-    std::swap(incident_hfs_per_he_[2*ids[0]+0], incident_hfs_per_he_[2*ids[1]+0]);
-    std::swap(incident_hfs_per_he_[2*ids[0]+1], incident_hfs_per_he_[2*ids[1]+1]);
+    edge_deleted_.swap(ids[0], ids[1]);
+    if (has_edge_bottom_up_incidences())
+    {
+        incident_hfs_per_he_.swap_rows(2*ids[0]+0, 2*ids[1]+0);
+        incident_hfs_per_he_.swap_rows(2*ids[0]+1, 2*ids[1]+1);
+    }
+    if (boundary_index_valid())
+        std::swap(n_boundary_faces_per_edge_[ids[0]], n_boundary_faces_per_edge_[ids[1]]);
     swap_edge_properties(_h1, _h2);
     swap_halfedge_properties(halfedge_handle(_h1, 0), halfedge_handle(_h2, 0));
     swap_halfedge_properties(halfedge_handle(_h1, 1), halfedge_handle(_h2, 1));
@@ -1770,32 +2808,53 @@ void TopologyKernel::swap_vertices(VertexHandle _h1, VertexHandle _h2)
 
     if (has_vertex_bottom_up_incidences())
     {
+        // the edges of both swapped vertices, each one only once (in the case that the two swapped vertices are connected by an edge)
+        std::set<EdgeHandle> edges;
         for (unsigned int i = 0; i < 2; ++i) // For both swapped vertices
         {
-            std::set<unsigned int> processed_edges; // to ensure ids are only swapped once (in the case that the two swapped vertices are connected by an edge)
-            std::vector<HalfEdgeHandle>& outgoing_hes = outgoing_hes_per_vertex_[ids[i]];
+            IncidenceArray<HalfEdgeHandle>::Row outgoing_hes = outgoing_hes_per_vertex_[ids[i]];
             for (unsigned int k = 0; k < outgoing_hes.size(); ++k) // for each outgoing halfedge
-            {
-                unsigned int e_id = outgoing_hes[k].idx() / 2;
+                edges.insert(edge_handle(outgoing_hes[k]));
+        }
 
-                if (processed_edges.find(e_id) == processed_edges.end())
-                {
-                    Edge& e = edges_[e_id];
-                    if (e.from_vertex() == (int)ids[0])
-                        e.set_from_vertex(VertexHandle(ids[1]));
-                    else if (e.from_vertex() == (int)ids[1])
-                        e.set_from_vertex(VertexHandle(ids[0]));
-
-                    if (e.to_vertex() == (int)ids[0])
-                        e.set_to_vertex(VertexHandle(ids[1]));
-                    else if (e.to_vertex() == (int)ids[1])
-                        e.set_to_vertex(VertexHandle(ids[0]));
-
-                    processed_edges.insert(e_id);
-                }
-            }
+        // the faces around the edges are re-hashed after the vertices are swapped
+        std::set<FaceHandle> faces;
+        const bool local_face_index = face_index_enabled_ && has_edge_bottom_up_incidences();
+        if (local_face_index)
+        {
+            get_incident_faces(edges, faces);
+            for (std::set<FaceHandle>::const_iterator f_it = faces.begin(); f_it != faces.end(); ++f_it)
+                face_index_.erase(face_hash(*f_it), f_it->idx());
+        }
+
+        for (std::set<EdgeHandle>::const_iterator e_it = edges.begin(); e_it != edges.end(); ++e_it)
+        {
+            const int e_id = e_it->idx();
+            Edge& e = edges_[e_id];
+            if (edge_index_enabled_)
+                edge_index_.erase(edge_hash(e.from_vertex(), e.to_vertex()), e_id);
+
+            if (e.from_vertex() == (int)ids[0])
+                e.set_from_vertex(VertexHandle(ids[1]));
+            else if (e.from_vertex() == (int)ids[1])
+                e.set_from_vertex(VertexHandle(ids[0]));
+
+            if (e.to_vertex() == (int)ids[0])
+                e.set_to_vertex(VertexHandle(ids[1]));
+            else if (e.to_vertex() == (int)ids[1])
+                e.set_to_vertex(VertexHandle(ids[0]));
+
+            if (edge_index_enabled_)
+                edge_index_.insert(edge_hash(e.from_vertex(), e.to_vertex()), e_id);
         }
 
+        if (local_face_index)
+        {
+            for (std::set<FaceHandle>::const_iterator f_it = faces.begin(); f_it != faces.end(); ++f_it)
+                face_index_.insert(face_hash(*f_it), f_it->idx());
+        }
+        else if (face_index_enabled_)
+            compute_face_index();
     }
     else
     {
@@ -1814,117 +2873,337 @@ void TopologyKernel::swap_vertices(VertexHandle _h1, VertexHandle _h2)
             else if (e.to_vertex() == (int)ids[1])
                 e.set_to_vertex(VertexHandle(ids[0]));
         }
+
+        if (edge_index_enabled_)
+            compute_edge_index();
+        if (face_index_enabled_)
+            compute_face_index();
+    }
+
+    if (cell_vertex_table_enabled_)
+    {
+        // only the rows of the cells around the swapped vertices change
+        std::set<CellHandle> cells;
+        bool local_cell_vertex_table = true;
+        if (vc_incidences_enabled_)
+        {
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                IncidenceArray<CellHandle>::Row incident_cells = incident_cells_per_vertex_[ids[i]];
+                cells.insert(incident_cells.begin(), incident_cells.end());
+            }
+        }
+        else if (has_full_bottom_up_incidences())
+        {
+            std::set<EdgeHandle> edges;
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                IncidenceArray<HalfEdgeHandle>::Row outgoing_hes = outgoing_hes_per_vertex_[ids[i]];
+                for (unsigned int k = 0; k < outgoing_hes.size(); ++k)
+                    edges.insert(edge_handle(outgoing_hes[k]));
+            }
+            std::set<FaceHandle> faces;
+            get_incident_faces(edges, faces);
+            get_incident_cells(faces, cells);
+        }
+        else
+            local_cell_vertex_table = false;
+
+        if (local_cell_vertex_table)
+        {
+            for (std::set<CellHandle>::const_iterator c_it = cells.begin(); c_it != cells.end(); ++c_it)
+            {
+                int* row = &cell_vertex_table_[(size_t)c_it->idx() * n_vertices_per_cell_];
+                for (unsigned int k = 0; k < n_vertices_per_cell_; ++k)
+                {
+                    if (row[k] == (int)ids[0])
+                        row[k] = ids[1];
+                    else if (row[k] == (int)ids[1])
+                        row[k] = ids[0];
+                }
+            }
+        }
+        else
+        {
+            for (std::vector<int>::iterator it = cell_vertex_table_.begin(),
+                    end = cell_vertex_table_.end(); it != end; ++it)
+            {
+                if (*it == (int)ids[0])
+                    *it = ids[1];
+                else if (*it == (int)ids[1])
+                    *it = ids[0];
+            }
+        }
     }
 
     // swap vector entries
-    bool tmp = vertex_deleted_[ids[0]];
-    vertex_deleted_[ids[0]] = vertex_deleted_[ids[1]];
-    vertex_deleted_[ids[1]] = tmp;
-    std::swap(outgoing_hes_per_vertex_[ids[0]], outgoing_hes_per_vertex_[ids[1]]);
+    vertex_deleted_.swap(ids[0], ids[1]);
+    if (has_vertex_bottom_up_incidences())
+        outgoing_hes_per_vertex_.swap_rows(ids[0], ids[1]);
+    if (vc_incidences_enabled_)
+        incident_cells_per_vertex_.swap_rows(ids[0], ids[1]);
+    if (boundary_index_valid())
+        std::swap(n_boundary_faces_per_vertex_[ids[0]], n_boundary_faces_per_vertex_[ids[1]]);
     swap_vertex_properties(_h1, _h2);
 }
 
 //========================================================================================
 
-void TopologyKernel::delete_multiple_vertices(const std::vector<bool>& _tag) {
-
-    assert(_tag.size() == n_vertices());
+namespace {
 
-    std::vector<int> newIndices(n_vertices(), -1);
-    int curIdx = 0;
+// Below this number of entities, the compaction loops run serially
+const int MinParallelCompaction = 16384;
 
-    std::vector<int>::iterator idx_it = newIndices.begin();
-    for(std::vector<bool>::const_iterator t_it = _tag.begin(),
-            t_end = _tag.end(); t_it != t_end; ++t_it, ++idx_it) {
+// Apply _corrector to every element of _vec, the elements are independent of each other
+template <class T, class CorrectorT>
+void correct_handles(std::vector<T>& _vec, CorrectorT _corrector, int _n_threads) {
 
-        if(!(*t_it)) {
-            // Not marked as deleted
-            *idx_it = curIdx;
-            ++curIdx;
-        } else {
-            --n_vertices_;
-        }
+    const int n = (int)_vec.size();
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(_n_threads) if(n >= MinParallelCompaction)
+#else
+    (void)_n_threads;
+#endif
+    for(int i = 0; i < n; ++i) {
+        _corrector(_vec[i]);
     }
-
-    // Delete properties accordingly
-    delete_multiple_vertex_props(_tag);
-
-    EdgeCorrector corrector(newIndices);
-    std::for_each(edges_.begin(), edges_.end(), corrector);
 }
 
-//========================================================================================
-
-void TopologyKernel::delete_multiple_edges(const std::vector<bool>& _tag) {
-
-    assert(_tag.size() == n_edges());
-
-    std::vector<int> newIndices(n_edges(), -1);
-    int curIdx = 0;
+// Maps halfedges or halffaces to the new indices of their full entities,
+// dropping the ones of deleted entities
+template <class HandleT>
+class HalfEntityFilter {
+public:
+    explicit HalfEntityFilter(const std::vector<int>& _newIndices) : newIndices_(_newIndices) {}
+
+    bool operator()(HandleT& _h) const {
+        const int idx = newIndices_[_h.idx() / 2];
+        if(idx < 0) return false;
+        _h = HandleT(2 * idx + (_h.idx() & 1));
+        return true;
+    }
 
-    std::vector<Edge> newEdges;
+private:
+    const std::vector<int>& newIndices_;
+};
 
-    std::vector<int>::iterator idx_it = newIndices.begin();
-    std::vector<Edge>::const_iterator e_it = edges_.begin();
+} // Namespace
 
-    for(std::vector<bool>::const_iterator t_it = _tag.begin(),
-            t_end = _tag.end(); t_it != t_end; ++t_it, ++idx_it, ++e_it) {
+/**
+ * \brief Number the untagged entities consecutively
+ *
+ * The entities are counted per chunk first, so that both passes
+ * can run in parallel and still yield the serial numbering.
+ *
+ * @param _tag The entities to be deleted
+ * @param _newIndices The new index of each entity, -1 for the tagged ones
+ * @return The number of untagged entities
+ */
+size_t TopologyKernel::compute_new_indices(const std::vector<bool>& _tag, std::vector<int>& _newIndices) const {
 
-        if(!(*t_it)) {
-            // Not marked as deleted
+    const int n = (int)_tag.size();
+    const int chunk_size = MinParallelCompaction;
+    const int n_chunks = (n + chunk_size - 1) / chunk_size;
 
-            newEdges.push_back(*e_it);
+    _newIndices.resize(n);
+    std::vector<int> chunkOffsets(n_chunks + 1, 0);
 
-            *idx_it = curIdx;
-            ++curIdx;
+#ifdef USE_OPENMP
+    const int n_threads = std::max(std::min(effective_num_threads(), n_chunks), 1);
+    #pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1) if(n_threads > 1)
+#endif
+    for(int c = 0; c < n_chunks; ++c) {
+        int count = 0;
+        for(int i = c * chunk_size, end = std::min(n, (c + 1) * chunk_size); i < end; ++i) {
+            if(!_tag[i]) ++count;
         }
+        chunkOffsets[c + 1] = count;
     }
 
-    // Swap edges
-    edges_.swap(newEdges);
+    for(int c = 0; c < n_chunks; ++c) {
+        chunkOffsets[c + 1] += chunkOffsets[c];
+    }
 
-    // Delete properties accordingly
-    delete_multiple_edge_props(_tag);
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1) if(n_threads > 1)
+#endif
+    for(int c = 0; c < n_chunks; ++c) {
+        int idx = chunkOffsets[c];
+        for(int i = c * chunk_size, end = std::min(n, (c + 1) * chunk_size); i < end; ++i) {
+            _newIndices[i] = _tag[i] ? -1 : idx++;
+        }
+    }
 
-    FaceCorrector corrector(newIndices);
-    std::for_each(faces_.begin(), faces_.end(), corrector);
+    return (size_t)chunkOffsets[n_chunks];
 }
 
 //========================================================================================
 
-void TopologyKernel::delete_multiple_faces(const std::vector<bool>& _tag) {
+void TopologyKernel::delete_multiple_bottom_up_incidences(const std::vector<bool>& _vertexTags,
+                                                          const std::vector<bool>& _edgeTags,
+                                                          const HandleRemap& _remap,
+                                                          bool _vertices, bool _edges, bool _faces) {
 
-    assert(_tag.size() == n_faces());
+    const int n_threads = effective_num_threads();
 
-    std::vector<int> newIndices(n_faces(), -1);
-    int curIdx = 0;
+    if(_vertices) {
+        outgoing_hes_per_vertex_.erase_tagged(_vertexTags,
+                HalfEntityFilter<HalfEdgeHandle>(_remap.edges), n_threads);
+    }
 
-    std::vector<Face> newFaces;
+    if(_edges) {
+        std::vector<bool> halfedgeTags(2u * _edgeTags.size());
+        for(size_t i = 0; i < _edgeTags.size(); ++i) {
+            halfedgeTags[2u * i] = halfedgeTags[2u * i + 1u] = _edgeTags[i];
+        }
+        incident_hfs_per_he_.erase_tagged(halfedgeTags,
+                HalfEntityFilter<HalfFaceHandle>(_remap.faces), n_threads);
+    }
 
-    std::vector<int>::iterator idx_it = newIndices.begin();
-    std::vector<Face>::const_iterator f_it = faces_.begin();
+    if(_faces) {
+        const int n = (int)incident_cell_per_hf_.size();
+        std::vector<CellHandle> newIncidentCells(2u * n_faces(), InvalidCellHandle);
+#ifdef USE_OPENMP
+        #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+        for(int i = 0; i < n; ++i) {
+            const int newFace = _remap.faces[i / 2];
+            const CellHandle ch = incident_cell_per_hf_[i];
+            if(newFace < 0 || !ch.is_valid()) continue;
+            newIncidentCells[2 * newFace + (i & 1)] = CellHandle(_remap.cells[ch.idx()]);
+        }
+        incident_cell_per_hf_.swap(newIncidentCells);
+    }
+}
 
-    for(std::vector<bool>::const_iterator t_it = _tag.begin(),
-            t_end = _tag.end(); t_it != t_end; ++t_it, ++idx_it, ++f_it) {
+//========================================================================================
+
+void TopologyKernel::delete_multiple_vertices(const std::vector<bool>& _tag) {
 
-        if(!(*t_it)) {
-            // Not marked as deleted
+    assert(_tag.size() == n_vertices());
 
-            newFaces.push_back(*f_it);
+    std::vector<int> newIndices;
+    n_vertices_ = compute_new_indices(_tag, newIndices);
+    const int n_threads = effective_num_threads();
 
-            *idx_it = curIdx;
-            ++curIdx;
+    vertex_deleted_.erase_tagged(_tag);
+
+    // Delete properties accordingly
+    delete_multiple_vertex_props(_tag, n_threads);
+
+    correct_handles(edges_, EdgeCorrector(newIndices), n_threads);
+
+    if(edge_index_enabled_) {
+        compute_edge_index();
+    }
+    if(face_index_enabled_) {
+        compute_face_index();
+    }
+    if(vc_incidences_enabled_) {
+        compute_vertex_cell_incidences();
+    }
+    if(cell_vertex_table_enabled_) {
+        // Entries of the remaining cells never refer to deleted vertices
+        const int n = (int)cell_vertex_table_.size();
+#ifdef USE_OPENMP
+        #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+        for(int i = 0; i < n; ++i) {
+            if(cell_vertex_table_[i] >= 0) cell_vertex_table_[i] = newIndices[cell_vertex_table_[i]];
         }
     }
+}
+
+//========================================================================================
+
+void TopologyKernel::delete_multiple_edges(const std::vector<bool>& _tag) {
+
+    assert(_tag.size() == n_edges());
+
+    std::vector<int> newIndices;
+    const size_t n_kept = compute_new_indices(_tag, newIndices);
+    const int n = (int)edges_.size();
+    const int n_threads = effective_num_threads();
+
+    std::vector<Edge> newEdges(n_kept, Edge(InvalidVertexHandle, InvalidVertexHandle));
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+    for(int i = 0; i < n; ++i) {
+        if(newIndices[i] >= 0) newEdges[newIndices[i]] = edges_[i];
+    }
+
+    // Swap edges
+    edges_.swap(newEdges);
+    edge_deleted_.erase_tagged(_tag);
+
+    if(edge_index_enabled_) {
+        compute_edge_index();
+    }
+
+    // Delete properties accordingly
+    delete_multiple_edge_props(_tag, n_threads);
+
+    // Drop unused slots so that only halfedges of existing faces are corrected
+    compact_face_halfedges();
+
+    correct_handles(face_halfedges_, FaceCorrector(newIndices), n_threads);
+}
+
+//========================================================================================
+
+void TopologyKernel::delete_multiple_faces(const std::vector<bool>& _tag) {
+
+    assert(_tag.size() == n_faces());
+
+    std::vector<int> newIndices;
+    const size_t n_kept = compute_new_indices(_tag, newIndices);
+    const int n = (int)face_offsets_.size();
+    const int n_threads = effective_num_threads();
+
+    std::vector<unsigned int> newValences(n_kept);
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+    for(int i = 0; i < n; ++i) {
+        if(newIndices[i] >= 0) newValences[newIndices[i]] = face_valences_[i];
+    }
+
+    std::vector<size_t> newOffsets(n_kept);
+    size_t n_halfedges = 0;
+    for(size_t i = 0; i < n_kept; ++i) {
+        newOffsets[i] = n_halfedges;
+        n_halfedges += newValences[i];
+    }
+
+    std::vector<HalfEdgeHandle> newHalfedges(n_halfedges);
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+    for(int i = 0; i < n; ++i) {
+        if(newIndices[i] < 0) continue;
+        std::vector<HalfEdgeHandle>::const_iterator first = face_halfedges_.begin() + face_offsets_[i];
+        std::copy(first, first + face_valences_[i], newHalfedges.begin() + newOffsets[newIndices[i]]);
+    }
 
     // Swap faces
-    faces_.swap(newFaces);
+    face_offsets_.swap(newOffsets);
+    face_valences_.swap(newValences);
+    face_halfedges_.swap(newHalfedges);
+    n_unused_face_halfedges_ = 0;
+    face_deleted_.erase_tagged(_tag);
+
+    if(face_index_enabled_) {
+        compute_face_index();
+    }
 
     // Delete properties accordingly
-    delete_multiple_face_props(_tag);
+    delete_multiple_face_props(_tag, n_threads);
+
+    // Drop unused slots so that only halffaces of existing cells are corrected
+    compact_cell_halffaces();
 
-    CellCorrector corrector(newIndices);
-    std::for_each(cells_.begin(), cells_.end(), corrector);
+    correct_handles(cell_halffaces_, CellCorrector(newIndices), n_threads);
 }
 
 //========================================================================================
@@ -1933,25 +3212,76 @@ void TopologyKernel::delete_multiple_cells(const std::vector<bool>& _tag) {
 
     assert(_tag.size() == n_cells());
 
-    std::vector<Cell> newCells;
+    std::vector<int> newIndices;
+    const size_t n_kept = compute_new_indices(_tag, newIndices);
+    const int n = (int)n_cells();
+    const int n_threads = effective_num_threads();
 
-    std::vector<Cell>::const_iterator c_it = cells_.begin();
+    std::vector<size_t> newOffsets;
+    std::vector<unsigned int> newValences;
+    size_t n_halffaces = n_kept * fixed_cell_valence_;
 
-    for(std::vector<bool>::const_iterator t_it = _tag.begin(),
-            t_end = _tag.end(); t_it != t_end; ++t_it, ++c_it) {
+    if(fixed_cell_valence_ == 0u) {
+        newValences.resize(n_kept);
+#ifdef USE_OPENMP
+        #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+        for(int i = 0; i < n; ++i) {
+            if(newIndices[i] >= 0) newValences[newIndices[i]] = cell_valences_[i];
+        }
 
-        if(!(*t_it)) {
-            // Not marked as deleted
+        newOffsets.resize(n_kept);
+        for(size_t i = 0; i < n_kept; ++i) {
+            newOffsets[i] = n_halffaces;
+            n_halffaces += newValences[i];
+        }
+    }
 
-            newCells.push_back(*c_it);
+    std::vector<HalfFaceHandle> newHalffaces(n_halffaces);
+    std::vector<int> newCellVertices;
+    if(cell_vertex_table_enabled_) {
+        newCellVertices.resize(n_kept * n_vertices_per_cell_);
+    }
+
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) if(n >= MinParallelCompaction)
+#endif
+    for(int i = 0; i < n; ++i) {
+        const int newIdx = newIndices[i];
+        if(newIdx < 0) continue;
+
+        const CellHandle ch(i);
+        const size_t valence = fixed_cell_valence_ ? fixed_cell_valence_ : cell_valences_[i];
+        const size_t newOffset = fixed_cell_valence_ ? (size_t)newIdx * fixed_cell_valence_ : newOffsets[newIdx];
+        std::vector<HalfFaceHandle>::const_iterator first = cell_halffaces_.begin() + cell_offset(ch);
+        std::copy(first, first + valence, newHalffaces.begin() + newOffset);
+
+        if(cell_vertex_table_enabled_) {
+            std::copy(cell_vertex_table_.begin() + (size_t)i * n_vertices_per_cell_,
+                      cell_vertex_table_.begin() + (size_t)(i + 1) * n_vertices_per_cell_,
+                      newCellVertices.begin() + (size_t)newIdx * n_vertices_per_cell_);
         }
     }
 
     // Swap cells
-    cells_.swap(newCells);
+    cell_offsets_.swap(newOffsets);
+    cell_valences_.swap(newValences);
+    cell_halffaces_.swap(newHalffaces);
+    n_unused_cell_halffaces_ = 0u;
+    cell_deleted_.erase_tagged(_tag);
+    if(cell_vertex_table_enabled_) {
+        cell_vertex_table_.swap(newCellVertices);
+    }
+
+    if(vc_incidences_enabled_) {
+        compute_vertex_cell_incidences();
+    }
+    if(hf_adjacency_enabled_) {
+        compute_cell_halfface_adjacency();
+    }
 
     // Delete properties accordingly
-    delete_multiple_cell_props(_tag);
+    delete_multiple_cell_props(_tag, n_threads);
 }
 
 //========================================================================================
@@ -1961,15 +3291,46 @@ CellIter TopologyKernel::delete_cell_range(const CellIter& _first, const CellIte
     assert(_first >= cells_begin());
     assert(_last <= cells_end());
 
-    std::vector<Cell>::iterator it = cells_.erase(cells_.begin() + _first->idx(), cells_.begin() + _last->idx());
+    const int first = _first->idx();
+    const int last = _last->idx();
+
+    if(first < last) {
+        if(fixed_cell_valence_ != 0u) {
+            cell_halffaces_.erase(cell_halffaces_.begin() + cell_offset(CellHandle(first)),
+                                  cell_halffaces_.begin() + (size_t)last * fixed_cell_valence_);
+        } else {
+            for(int i = first; i < last; ++i) {
+                n_unused_cell_halffaces_ += cell_valences_[i];
+            }
+            cell_offsets_.erase(cell_offsets_.begin() + first, cell_offsets_.begin() + last);
+            cell_valences_.erase(cell_valences_.begin() + first, cell_valences_.begin() + last);
+            compact_cell_halffaces();
+        }
+        cell_deleted_.erase(first, last);
+        if(slot_reuse_enabled_) {
+            collect_free_slots(cell_deleted_, free_cells_);
+        }
+        if(cell_vertex_table_enabled_) {
+            cell_vertex_table_.erase(cell_vertex_table_.begin() + (size_t)first * n_vertices_per_cell_,
+                                     cell_vertex_table_.begin() + (size_t)last * n_vertices_per_cell_);
+        }
+    }
+
+    // Needed by the halfface reordering
+    if(hf_adjacency_enabled_) {
+        compute_cell_halfface_adjacency();
+    }
 
     // Re-compute face bottom-up incidences if necessary
     if(f_bottom_up_) {
         f_bottom_up_ = false;
         enable_face_bottom_up_incidences(true);
     }
+    if(vc_incidences_enabled_) {
+        compute_vertex_cell_incidences();
+    }
 
-    return CellIter(this, CellHandle((int)(it - cells_.begin())));
+    return CellIter(this, CellHandle(first));
 }
 
 void TopologyKernel::enable_deferred_deletion(bool _enable)
@@ -1982,6 +3343,35 @@ void TopologyKernel::enable_deferred_deletion(bool _enable)
 
 //========================================================================================
 
+void TopologyKernel::enable_slot_reuse(bool _enable) {
+
+    if(_enable && !slot_reuse_enabled_) {
+        slot_reuse_enabled_ = true;
+        collect_free_slots(vertex_deleted_, free_vertices_);
+        collect_free_slots(edge_deleted_, free_edges_);
+        collect_free_slots(face_deleted_, free_faces_);
+        collect_free_slots(cell_deleted_, free_cells_);
+
+        // Drop the free slots from the indices
+        if(edge_index_enabled_ && !free_edges_.empty()) {
+            compute_edge_index();
+        }
+        if(face_index_enabled_ && !free_faces_.empty()) {
+            compute_face_index();
+        }
+    }
+
+    if(!_enable) {
+        free_vertices_.clear();
+        free_edges_.clear();
+        free_faces_.clear();
+        free_cells_.clear();
+        slot_reuse_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
 /// Get edge with handle _edgeHandle
 const OpenVolumeMeshEdge& TopologyKernel::edge(const EdgeHandle& _edgeHandle) const {
 
@@ -1994,23 +3384,30 @@ const OpenVolumeMeshEdge& TopologyKernel::edge(const EdgeHandle& _edgeHandle) co
 //========================================================================================
 
 /// Get face with handle _faceHandle
-const OpenVolumeMeshFace& TopologyKernel::face(const FaceHandle& _faceHandle) const {
+OpenVolumeMeshFace TopologyKernel::face(const FaceHandle& _faceHandle) const {
 
     // Test if face is valid
-    assert(_faceHandle.is_valid() && (size_t)_faceHandle.idx() < faces_.size());
+    assert(_faceHandle.is_valid() && (size_t)_faceHandle.idx() < face_offsets_.size());
+
+    if(face_halfedges_.empty())
+        return Face(0, face_valences_[_faceHandle.idx()]);
 
-    return faces_[_faceHandle.idx()];
+    return Face(&face_halfedges_[0] + face_offsets_[_faceHandle.idx()],
+                face_valences_[_faceHandle.idx()]);
 }
 
 //========================================================================================
 
 /// Get cell with handle _cellHandle
-const OpenVolumeMeshCell& TopologyKernel::cell(const CellHandle& _cellHandle) const {
+OpenVolumeMeshCell TopologyKernel::cell(const CellHandle& _cellHandle) const {
 
     // Test if cell is valid
-    assert(_cellHandle.is_valid() && (size_t)_cellHandle.idx() < cells_.size());
+    assert(_cellHandle.is_valid() && (size_t)_cellHandle.idx() < n_cells());
+
+    if(cell_halffaces_.empty())
+        return Cell(0, valence(_cellHandle));
 
-    return cells_[_cellHandle.idx()];
+    return Cell(&cell_halffaces_[0] + cell_offset(_cellHandle), valence(_cellHandle));
 }
 
 //========================================================================================
@@ -2026,30 +3423,6 @@ OpenVolumeMeshEdge& TopologyKernel::edge(const EdgeHandle& _edgeHandle) {
 
 //========================================================================================
 
-/// Get face with handle _faceHandle
-OpenVolumeMeshFace& TopologyKernel::face(const FaceHandle& _faceHandle) {
-
-    // Test if face is valid
-    assert((size_t)_faceHandle.idx() < faces_.size());
-    assert(_faceHandle.idx() >= 0);
-
-    return faces_[_faceHandle.idx()];
-}
-
-//========================================================================================
-
-/// Get cell with handle _cellHandle
-OpenVolumeMeshCell& TopologyKernel::cell(const CellHandle& _cellHandle) {
-
-    // Test if cell is valid
-    assert((size_t)_cellHandle.idx() < cells_.size());
-    assert(_cellHandle.idx() >= 0);
-
-    return cells_[_cellHandle.idx()];
-}
-
-//========================================================================================
-
 /// Get edge that corresponds to halfedge with handle _halfEdgeHandle
 OpenVolumeMeshEdge TopologyKernel::halfedge(const HalfEdgeHandle& _halfEdgeHandle) const {
 
@@ -2071,15 +3444,15 @@ OpenVolumeMeshEdge TopologyKernel::halfedge(const HalfEdgeHandle& _halfEdgeHandl
 OpenVolumeMeshFace TopologyKernel::halfface(const HalfFaceHandle& _halfFaceHandle) const {
 
     // Is handle in range?
-    assert((size_t)_halfFaceHandle.idx() < (faces_.size() * 2));
+    assert((size_t)_halfFaceHandle.idx() < (face_offsets_.size() * 2));
     assert(_halfFaceHandle.idx() >= 0);
 
     // In case the handle is not even, just return the corresponding face
     // Otherwise return the opposite halfface via opposite()
     if(_halfFaceHandle.idx() % 2 == 0)
-        return faces_[(int)(_halfFaceHandle.idx() / 2)];
+        return face(face_handle(_halfFaceHandle));
     else
-        return opposite_halfface(faces_[(int)(_halfFaceHandle.idx() / 2)]);
+        return opposite_halfface(face(face_handle(_halfFaceHandle)));
 }
 
 //========================================================================================
@@ -2106,14 +3479,14 @@ OpenVolumeMeshFace TopologyKernel::opposite_halfface(const HalfFaceHandle& _half
 
     // Is handle in range?
     assert(_halfFaceHandle.idx() >= 0);
-    assert((size_t)_halfFaceHandle.idx() < (faces_.size() * 2));
+    assert((size_t)_halfFaceHandle.idx() < (face_offsets_.size() * 2));
 
     // In case the handle is not even, just return the corresponding face
     // Otherwise return the opposite via the first face's opposite() function
     if(_halfFaceHandle.idx() % 2 != 0)
-        return faces_[(int)(_halfFaceHandle.idx() / 2)];
+        return face(face_handle(_halfFaceHandle));
     else
-        return opposite_halfface(faces_[(int)(_halfFaceHandle.idx() / 2)]);
+        return opposite_halfface(face(face_handle(_halfFaceHandle)));
 }
 
 //========================================================================================
@@ -2123,6 +3496,12 @@ HalfEdgeHandle TopologyKernel::halfedge(const VertexHandle& _vh1, const VertexHa
     assert(_vh1.idx() < (int)n_vertices());
     assert(_vh2.idx() < (int)n_vertices());
 
+    if(edge_index_enabled_) {
+        const int idx = find_edge(_vh1, _vh2);
+        if(idx < 0) return InvalidHalfEdgeHandle;
+        return halfedge_handle(EdgeHandle(idx), edges_[idx].from_vertex() == _vh1 ? 0 : 1);
+    }
+
     for(VertexOHalfEdgeIter voh_it = voh_iter(_vh1); voh_it.valid(); ++voh_it) {
         if(halfedge(*voh_it).to_vertex() == _vh2) {
             return *voh_it;
@@ -2138,6 +3517,12 @@ HalfFaceHandle TopologyKernel::halfface(const std::vector<VertexHandle>& _vs) co
 
     assert(_vs.size() > 2);
 
+    if(face_index_enabled_) {
+        const HalfFaceHandle hfh = find_halfface(_vs);
+        if(hfh.is_valid()) return hfh;
+        // _vs might only contain some of the face's vertices
+    }
+
     VertexHandle v0 = _vs[0], v1 = _vs[1], v2 = _vs[2];
 
     assert(v0.is_valid() && v1.is_valid() && v2.is_valid());
@@ -2160,6 +3545,9 @@ HalfFaceHandle TopologyKernel::halfface_extensive(const std::vector<VertexHandle
 
   assert(_vs.size() > 2);
 
+  if(face_index_enabled_)
+    return find_halfface(_vs);
+
   VertexHandle v0 = _vs[0];
   VertexHandle v1 = _vs[1];
 
@@ -2224,40 +3612,44 @@ HalfFaceHandle TopologyKernel::halfface(const std::vector<HalfEdgeHandle>& _hes)
 
 HalfEdgeHandle TopologyKernel::next_halfedge_in_halfface(const HalfEdgeHandle& _heh, const HalfFaceHandle& _hfh) const {
 
-    assert(_heh.is_valid() && (size_t)_heh.idx() < edges_.size() * 2u);
-    assert(_hfh.is_valid() && (size_t)_hfh.idx() < faces_.size() * 2u);
-
-    std::vector<HalfEdgeHandle> hes = halfface(_hfh).halfedges();
-
-    for(std::vector<HalfEdgeHandle>::const_iterator it = hes.begin();
-            it != hes.end(); ++it) {
-        if(*it == _heh) {
-            if((it + 1) != hes.end()) return *(it + 1);
-            else return *hes.begin();
-        }
-    }
+    const HalfFaceCorner c = corner(_heh, _hfh);
+    if(!c.is_valid()) return InvalidHalfEdgeHandle;
 
-    return InvalidHalfEdgeHandle;
+    return corner_halfedge(next_corner(c));
 }
 
 //========================================================================================
 
 HalfEdgeHandle TopologyKernel::prev_halfedge_in_halfface(const HalfEdgeHandle& _heh, const HalfFaceHandle& _hfh) const {
 
-    assert(_heh.is_valid() && (size_t)_heh.idx() < edges_.size() * 2u);
-    assert(_hfh.is_valid() && (size_t)_hfh.idx() < faces_.size() * 2u);
+    const HalfFaceCorner c = corner(_heh, _hfh);
+    if(!c.is_valid()) return InvalidHalfEdgeHandle;
 
-    std::vector<HalfEdgeHandle> hes = halfface(_hfh).halfedges();
+    return corner_halfedge(prev_corner(c));
+}
 
-    for(std::vector<HalfEdgeHandle>::const_iterator it = hes.begin();
-            it != hes.end(); ++it) {
-        if(*it == _heh) {
-            if(it != hes.begin()) return *(it - 1);
-            else return *(hes.end() - 1);
+//========================================================================================
+
+HalfFaceCorner TopologyKernel::corner(const HalfEdgeHandle& _heh, const HalfFaceHandle& _hfh) const {
+
+    assert(_heh.is_valid() && (size_t)_heh.idx() < edges_.size() * 2u);
+    assert(_hfh.is_valid() && (size_t)_hfh.idx() < face_offsets_.size() * 2u);
+
+    // Search the face's stored halfedges, for odd halffaces
+    // the opposite halfedge in reverse order
+    const int f = face_handle(_hfh).idx();
+    const unsigned int n = face_valences_[f];
+    const HalfEdgeHandle* hes = &face_halfedges_[0] + face_offsets_[f];
+    const bool odd = (_hfh.idx() % 2 != 0);
+    const HalfEdgeHandle heh = odd ? opposite_halfedge_handle(_heh) : _heh;
+
+    for(unsigned int i = 0; i < n; ++i) {
+        if(hes[i] == heh) {
+            return HalfFaceCorner(_hfh, odd ? n - 1u - i : i);
         }
     }
 
-    return InvalidHalfEdgeHandle;
+    return HalfFaceCorner();
 }
 
 //========================================================================================
@@ -2265,7 +3657,7 @@ HalfEdgeHandle TopologyKernel::prev_halfedge_in_halfface(const HalfEdgeHandle& _
 HalfFaceHandle
 TopologyKernel::adjacent_halfface_in_cell(const HalfFaceHandle& _halfFaceHandle, const HalfEdgeHandle& _halfEdgeHandle) const {
 
-    assert(_halfFaceHandle.is_valid() && (size_t)_halfFaceHandle.idx() < faces_.size() * 2u);
+    assert(_halfFaceHandle.is_valid() && (size_t)_halfFaceHandle.idx() < face_offsets_.size() * 2u);
     assert(_halfEdgeHandle.is_valid() && (size_t)_halfEdgeHandle.idx() < edges_.size() * 2u);
     assert(has_face_bottom_up_incidences());
     assert((size_t)_halfFaceHandle.idx() < incident_cell_per_hf_.size());
@@ -2275,25 +3667,53 @@ TopologyKernel::adjacent_halfface_in_cell(const HalfFaceHandle& _halfFaceHandle,
         return InvalidHalfFaceHandle;
     }
 
-    OpenVolumeMeshCell c = cell(incident_cell_per_hf_[_halfFaceHandle.idx()]);
+    // Read the stored halffaces and halfedges directly, this is called
+    // for every incident halfface when the incidences are reordered
+    const CellHandle ch = incident_cell_per_hf_[_halfFaceHandle.idx()];
+    const HalfFaceHandle* hf_begin = &cell_halffaces_[0] + cell_offset(ch);
+    const HalfFaceHandle* hf_end = hf_begin + valence(ch);
+    const EdgeHandle eh = edge_handle(_halfEdgeHandle);
+
+    if(hf_adjacency_enabled_) {
+
+        // Find the entries of the halfface and the edge's position in its face
+        size_t offset = 0;
+        const HalfFaceHandle* hf_it = hf_begin;
+        for(; hf_it != hf_end && *hf_it != _halfFaceHandle; ++hf_it) {
+            offset += face_valences_[face_handle(*hf_it).idx()];
+        }
+        if(hf_it == hf_end) return InvalidHalfFaceHandle;
+
+        const FaceHandle fh = face_handle(_halfFaceHandle);
+        const HalfEdgeHandle* hes = &face_halfedges_[0] + face_offsets_[fh.idx()];
+        const ConstArrayView<unsigned char> adjacent = adjacent_hf_per_cell_[ch.idx()];
+        for(unsigned int k = 0; k < face_valences_[fh.idx()]; ++k) {
+            if(edge_handle(hes[k]) == eh) {
+                const unsigned char pos = adjacent[offset + k];
+                return (pos == NoAdjacentHalfFace) ? InvalidHalfFaceHandle : hf_begin[pos];
+            }
+        }
+        return InvalidHalfFaceHandle;
+    }
 
     // Make sure that _halfFaceHandle is incident to _halfEdgeHandle
     bool skipped = false;
     bool found = false;
     HalfFaceHandle idx = InvalidHalfFaceHandle;
-    for(std::vector<HalfFaceHandle>::const_iterator hf_it = c.halffaces().begin();
-            hf_it != c.halffaces().end(); ++hf_it) {
+    for(const HalfFaceHandle* hf_it = hf_begin; hf_it != hf_end; ++hf_it) {
 
         if(*hf_it == _halfFaceHandle) {
             skipped = true;
             continue;
         }
 
-        OpenVolumeMeshFace hf = halfface(*hf_it);
-        for(std::vector<HalfEdgeHandle>::const_iterator he_it = hf.halfedges().begin();
-            he_it != hf.halfedges().end(); ++he_it) {
+        // Only edges are compared, so the orientation of the face does not matter
+        const FaceHandle fh = face_handle(*hf_it);
+        const HalfEdgeHandle* he_begin = &face_halfedges_[0] + face_offsets_[fh.idx()];
+        const HalfEdgeHandle* he_end = he_begin + face_valences_[fh.idx()];
+        for(const HalfEdgeHandle* he_it = he_begin; he_it != he_end; ++he_it) {
 
-            if(edge_handle(*he_it) == edge_handle(_halfEdgeHandle)) {
+            if(edge_handle(*he_it) == eh) {
                 found = true;
                 idx = *hf_it;
             }
@@ -2320,58 +3740,709 @@ CellHandle TopologyKernel::incident_cell(const HalfFaceHandle& _halfFaceHandle)
 
 //========================================================================================
 
-void TopologyKernel::compute_vertex_bottom_up_incidences() {
+void TopologyKernel::enable_edge_index(bool _enable) {
 
-    // Clear incidences
-    outgoing_hes_per_vertex_.clear();
-    outgoing_hes_per_vertex_.resize(n_vertices());
+    if(_enable && !edge_index_enabled_) {
+        edge_index_enabled_ = true;
+        compute_edge_index();
+    }
 
-    // Store outgoing halfedges per vertex
-    int n_edges = (int)edges_.size();
-    for(int i = 0; i < n_edges; ++i) {
-        if (edge_deleted_[i])
-            continue;
+    if(!_enable) {
+        edge_index_.clear();
+        edge_index_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_edge_index() {
+
+    edge_index_.clear();
+    edge_index_.reserve(edges_.size());
+
+    for(size_t i = 0; i < edges_.size(); ++i) {
+        if(edge_deleted_[i]) continue;
+        edge_index_.insert(edge_hash(edges_[i].from_vertex(), edges_[i].to_vertex()), (int)i);
+    }
+}
+
+//========================================================================================
+
+size_t TopologyKernel::edge_hash(const VertexHandle& _vh1, const VertexHandle& _vh2) {
+
+    // Independent of the edge's orientation
+    const size_t a = (size_t)std::min(_vh1.idx(), _vh2.idx());
+    const size_t b = (size_t)std::max(_vh1.idx(), _vh2.idx());
+
+    size_t h = a * 0x9e3779b1u;
+    h ^= b + 0x9e3779b9u + (h << 6) + (h >> 2);
+    return h * 0x85ebca6bu ^ (h >> 13);
+}
+
+//========================================================================================
+
+int TopologyKernel::find_edge(const VertexHandle& _vh1, const VertexHandle& _vh2) const {
+
+    return edge_index_.find(edge_hash(_vh1, _vh2), EdgeMatch(edges_, edge_deleted_, _vh1, _vh2));
+}
+
+//========================================================================================
+
+void TopologyKernel::enable_face_index(bool _enable) {
+
+    if(_enable && !face_index_enabled_) {
+        face_index_enabled_ = true;
+        compute_face_index();
+    }
+
+    if(!_enable) {
+        face_index_.clear();
+        face_index_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_face_index() {
+
+    face_index_.clear();
+    face_index_.reserve(face_offsets_.size());
+
+    for(size_t i = 0; i < face_offsets_.size(); ++i) {
+        if(face_deleted_[i]) continue;
+        face_index_.insert(face_hash(FaceHandle((int)i)), (int)i);
+    }
+}
+
+//========================================================================================
+
+namespace {
+
+// Scrambles a vertex index so that sums of several of them spread well
+inline size_t mix_vertex_index(int _idx) {
+
+    size_t h = (size_t)_idx * 0x9e3779b1u;
+    h ^= h >> 15;
+    h *= 0x85ebca6bu;
+    return h ^ (h >> 13);
+}
+
+} // Namespace
+
+size_t TopologyKernel::face_hash(const std::vector<VertexHandle>& _vs) {
+
+    // The sum does not depend on the order (and thus on the orientation
+    // or starting vertex) of the vertices
+    size_t h = _vs.size() * 0xc2b2ae35u;
+    for(std::vector<VertexHandle>::const_iterator it = _vs.begin(); it != _vs.end(); ++it) {
+        h += mix_vertex_index(it->idx());
+    }
+    return h;
+}
+
+size_t TopologyKernel::face_hash(const FaceHandle& _fh) const {
+
+    const size_t valence = face_valences_[_fh.idx()];
+    const HalfEdgeHandle* hes = &face_halfedges_[0] + face_offsets_[_fh.idx()];
+
+    size_t h = valence * 0xc2b2ae35u;
+    for(size_t i = 0; i < valence; ++i) {
+        h += mix_vertex_index(halfedge_from_vertex(hes[i]).idx());
+    }
+    return h;
+}
+
+//========================================================================================
+
+int TopologyKernel::match_face_vertices(const FaceHandle& _fh, const std::vector<VertexHandle>& _vs) const {
+
+    const size_t n = face_valences_[_fh.idx()];
+    if(n != _vs.size()) return -1;
+
+    const HalfEdgeHandle* hes = &face_halfedges_[0] + face_offsets_[_fh.idx()];
+
+    for(size_t k = 0; k < n; ++k) {
+
+        if(halfedge_from_vertex(hes[k]) != _vs[0]) continue;
+
+        // Same cyclic order as the face's halfedges
+        bool forward = true;
+        for(size_t i = 1; i < n && forward; ++i) {
+            forward = (halfedge_from_vertex(hes[(k + i) % n]) == _vs[i]);
+        }
+        if(forward) return 0;
+
+        // Reversed order, i.e. the opposite halfface
+        bool backward = true;
+        for(size_t i = 1; i < n && backward; ++i) {
+            backward = (halfedge_from_vertex(hes[(k + n - i) % n]) == _vs[i]);
+        }
+        if(backward) return 1;
+    }
+
+    return -1;
+}
+
+//========================================================================================
+
+HalfFaceHandle TopologyKernel::find_halfface(const std::vector<VertexHandle>& _vs) const {
+
+    const int idx = face_index_.find(face_hash(_vs), FaceMatch(*this, _vs));
+    if(idx < 0) return InvalidHalfFaceHandle;
+
+    const FaceHandle fh(idx);
+    return halfface_handle(fh, (unsigned char)match_face_vertices(fh, _vs));
+}
+
+//========================================================================================
+
+void TopologyKernel::vertex_k_ring(const VertexHandle& _vh, unsigned int _k,
+                                   std::vector<VertexHandle>& _out, KRingScratch& _scratch) const {
+
+    _out.clear();
+
+    if(!v_bottom_up_) {
+#ifndef NDEBUG
+        std::cerr << "vertex_k_ring() needs vertex bottom-up incidences!" << std::endl;
+#endif
+        return;
+    }
+
+    assert(_vh.is_valid() && (size_t)_vh.idx() < n_vertices());
+
+    _scratch.begin(n_vertices());
+    _scratch.visit(_vh.idx());
+
+    // Breadth-first search, _out doubles as the queue. Ring d is
+    // [ring_begin, ring_end), starting with _vh as ring zero.
+    _out.push_back(_vh);
+    size_t ring_begin = 0;
+    for(unsigned int d = 0; d < _k; ++d) {
+
+        const size_t ring_end = _out.size();
+        for(size_t i = ring_begin; i < ring_end; ++i) {
+
+            ConstArrayView<HalfEdgeHandle> hes = outgoing_hes_per_vertex_[_out[i].idx()];
+            for(ConstArrayView<HalfEdgeHandle>::const_iterator he_it = hes.begin();
+                    he_it != hes.end(); ++he_it) {
+
+                if(edge_deleted_[he_it->idx() / 2]) continue;
+
+                const VertexHandle vh = halfedge_from_vertex(opposite_halfedge_handle(*he_it));
+                if(_scratch.visit(vh.idx())) _out.push_back(vh);
+            }
+        }
+
+        if(_out.size() == ring_end) break;
+        ring_begin = ring_end;
+    }
+
+    _out.erase(_out.begin());
+}
+
+//========================================================================================
+
+void TopologyKernel::cell_k_ring(const CellHandle& _ch, unsigned int _k,
+                                 std::vector<CellHandle>& _out, KRingScratch& _scratch) const {
+
+    _out.clear();
+
+    if(!f_bottom_up_) {
+#ifndef NDEBUG
+        std::cerr << "cell_k_ring() needs face bottom-up incidences!" << std::endl;
+#endif
+        return;
+    }
+
+    assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells());
+
+    _scratch.begin(n_cells());
+    _scratch.visit(_ch.idx());
+
+    // Same as in vertex_k_ring()
+    _out.push_back(_ch);
+    size_t ring_begin = 0;
+    for(unsigned int d = 0; d < _k; ++d) {
+
+        const size_t ring_end = _out.size();
+        for(size_t i = ring_begin; i < ring_end; ++i) {
+
+            const HalfFaceHandle* hfs = &cell_halffaces_[cell_offset(_out[i])];
+            const unsigned int n_hfs = valence(_out[i]);
+            for(unsigned int j = 0; j < n_hfs; ++j) {
+
+                const CellHandle ch = incident_cell_per_hf_[opposite_halfface_handle(hfs[j]).idx()];
+                if(!ch.is_valid() || cell_deleted_[ch.idx()]) continue;
+                if(_scratch.visit(ch.idx())) _out.push_back(ch);
+            }
+        }
+
+        if(_out.size() == ring_end) break;
+        ring_begin = ring_end;
+    }
+
+    _out.erase(_out.begin());
+}
+
+//========================================================================================
+
+void TopologyKernel::enable_vertex_cell_incidences(bool _enable) {
+
+    if(_enable && !vc_incidences_enabled_) {
+        vc_incidences_enabled_ = true;
+        compute_vertex_cell_incidences();
+    }
+
+    if(!_enable) {
+        incident_cells_per_vertex_.clear();
+        vc_incidences_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::get_cell_vertex_set(const CellHandle& _ch, CellVertexSet& _vs) const {
+
+    _vs.clear();
+
+    const HalfFaceHandle* hfs = &cell_halffaces_[cell_offset(_ch)];
+    const unsigned int n_hfs = valence(_ch);
+    for(unsigned int i = 0; i < n_hfs; ++i) {
+        const size_t f = (size_t)hfs[i].idx() / 2u;
+        const HalfEdgeHandle* hes = &face_halfedges_[face_offsets_[f]];
+        for(unsigned int j = 0; j < face_valences_[f]; ++j) {
+            _vs.insert_sorted_unique(halfedge_from_vertex(hes[j]));
+        }
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::add_vertex_cell_incidences(const CellHandle& _ch) {
+
+    CellVertexSet vs;
+    get_cell_vertex_set(_ch, vs);
+    for(CellVertexSet::const_iterator v_it = vs.begin(); v_it != vs.end(); ++v_it) {
+        assert((size_t)v_it->idx() < incident_cells_per_vertex_.size());
+        incident_cells_per_vertex_[v_it->idx()].push_back(_ch);
+    }
+}
+
+void TopologyKernel::remove_vertex_cell_incidences(const CellHandle& _ch) {
+
+    CellVertexSet vs;
+    get_cell_vertex_set(_ch, vs);
+    for(CellVertexSet::const_iterator v_it = vs.begin(); v_it != vs.end(); ++v_it) {
+        IncidenceArray<CellHandle>::Row cells = incident_cells_per_vertex_[v_it->idx()];
+        cells.erase(std::remove(cells.begin(), cells.end(), _ch), cells.end());
+    }
+}
+
+//========================================================================================
+
+// Emits each cell to the lists of its vertices
+class TopologyKernel::IncidentCellGenerator {
+public:
+    explicit IncidentCellGenerator(const TopologyKernel& _kernel) : kernel_(_kernel) {}
+
+    template <class Sink>
+    void operator()(size_t _i, Sink& _sink) const {
+
+        if(kernel_.cell_deleted_[_i]) return;
+
+        CellVertexSet vs;
+        kernel_.get_cell_vertex_set(CellHandle((int)_i), vs);
+        for(CellVertexSet::const_iterator v_it = vs.begin(); v_it != vs.end(); ++v_it) {
+            _sink(v_it->idx(), CellHandle((int)_i));
+        }
+    }
+
+private:
+    const TopologyKernel& kernel_;
+};
+
+void TopologyKernel::compute_vertex_cell_incidences() {
+
+    incident_cells_per_vertex_.build(n_vertices(), n_cells(),
+                                     IncidentCellGenerator(*this), effective_num_threads());
+}
+
+//========================================================================================
+
+// Emits the halfface adjacencies of a cell (see adjacent_hf_per_cell_)
+class TopologyKernel::HalfFaceAdjacencyGenerator {
+public:
+    explicit HalfFaceAdjacencyGenerator(const TopologyKernel& _kernel) : kernel_(_kernel) {}
+
+    // Sink that appends the entries of a single cell to its row
+    class RowSink {
+    public:
+        explicit RowSink(const IncidenceArray<unsigned char>::Row& _row) : row_(_row) {}
+
+        void operator()(size_t, unsigned char _pos) const { row_.push_back(_pos); }
+
+    private:
+        IncidenceArray<unsigned char>::Row row_;
+    };
+
+    template <class Sink>
+    void operator()(size_t _i, Sink& _sink) const {
+
+        if(kernel_.cell_deleted_[_i]) return;
+
+        const CellHandle ch((int)_i);
+        const HalfFaceHandle* hfs = &kernel_.cell_halffaces_[0] + kernel_.cell_offset(ch);
+        const size_t n = kernel_.valence(ch);
+        assert(n < (size_t)NoAdjacentHalfFace);
+
+        for(size_t j = 0; j < n; ++j) {
+
+            const ConstArrayView<HalfEdgeHandle> hes = face_halfedges(hfs[j]);
+            for(size_t k = 0; k < hes.size(); ++k) {
+
+                // First other halfface of the cell that contains the edge
+                const EdgeHandle eh = edge_handle(hes[k]);
+                unsigned char pos = NoAdjacentHalfFace;
+                for(size_t l = 0; l < n && pos == NoAdjacentHalfFace; ++l) {
+                    if(l == j) continue;
+                    const ConstArrayView<HalfEdgeHandle> other = face_halfedges(hfs[l]);
+                    for(size_t m = 0; m < other.size(); ++m) {
+                        if(edge_handle(other[m]) == eh) {
+                            pos = (unsigned char)l;
+                            break;
+                        }
+                    }
+                }
+                _sink(_i, pos);
+            }
+        }
+    }
+
+private:
+    ConstArrayView<HalfEdgeHandle> face_halfedges(const HalfFaceHandle& _hfh) const {
+        const FaceHandle fh = face_handle(_hfh);
+        return ConstArrayView<HalfEdgeHandle>(&kernel_.face_halfedges_[0] + kernel_.face_offsets_[fh.idx()],
+                                              kernel_.face_valences_[fh.idx()]);
+    }
+
+    const TopologyKernel& kernel_;
+};
+
+void TopologyKernel::enable_cell_halfface_adjacency(bool _enable) {
+
+    if(_enable && !hf_adjacency_enabled_) {
+        hf_adjacency_enabled_ = true;
+        compute_cell_halfface_adjacency();
+    }
+
+    if(!_enable) {
+        adjacent_hf_per_cell_.clear();
+        hf_adjacency_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_cell_halfface_adjacency() {
+
+    adjacent_hf_per_cell_.build(n_cells(), n_cells(),
+                                HalfFaceAdjacencyGenerator(*this), effective_num_threads());
+}
+
+//========================================================================================
+
+void TopologyKernel::update_cell_halfface_adjacency(const CellHandle& _ch) {
+
+    assert((size_t)_ch.idx() < adjacent_hf_per_cell_.size());
+
+    const IncidenceArray<unsigned char>::Row row = adjacent_hf_per_cell_[_ch.idx()];
+    row.clear();
+    HalfFaceAdjacencyGenerator::RowSink sink(row);
+    HalfFaceAdjacencyGenerator(*this)(_ch.idx(), sink);
+}
+
+//========================================================================================
+
+void TopologyKernel::enable_boundary_index(bool _enable) {
+
+    if(_enable && !boundary_index_enabled_) {
+        boundary_index_enabled_ = true;
+        compute_boundary_index();
+    }
+
+    if(!_enable) {
+        boundary_face_pos_.clear();
+        boundary_faces_.clear();
+        n_boundary_faces_per_edge_.clear();
+        n_boundary_faces_per_vertex_.clear();
+        boundary_index_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_boundary_index() {
+
+    // Not computable without the face bottom-up incidences,
+    // it is rebuilt as soon as they are enabled
+    if(!f_bottom_up_) return;
+
+    boundary_face_pos_.assign(n_faces(), -1);
+    boundary_faces_.clear();
+    n_boundary_faces_per_edge_.assign(n_edges(), 0u);
+    n_boundary_faces_per_vertex_.assign(n_vertices(), 0u);
+
+    for(size_t i = 0; i < n_faces(); ++i) {
+        update_boundary_face(FaceHandle((int)i));
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::set_boundary_face(const FaceHandle& _fh, bool _boundary) {
+
+    assert((size_t)_fh.idx() < boundary_face_pos_.size());
+
+    int& pos = boundary_face_pos_[_fh.idx()];
+    if((pos >= 0) == _boundary) return;
+
+    if(_boundary) {
+        pos = (int)boundary_faces_.size();
+        boundary_faces_.push_back(_fh);
+    } else {
+        // Move the last face into the gap
+        const FaceHandle last = boundary_faces_.back();
+        boundary_faces_[pos] = last;
+        boundary_face_pos_[last.idx()] = pos;
+        boundary_faces_.pop_back();
+        pos = -1;
+    }
+
+    const Face::HalfEdgeView hes = face(_fh).halfedges();
+    for(Face::HalfEdgeView::const_iterator he_it = hes.begin(),
+            he_end = hes.end(); he_it != he_end; ++he_it) {
+
+        unsigned int& n_e = n_boundary_faces_per_edge_[edge_handle(*he_it).idx()];
+        unsigned int& n_v = n_boundary_faces_per_vertex_[halfedge_from_vertex(*he_it).idx()];
+        if(_boundary) {
+            ++n_e;
+            ++n_v;
+        } else {
+            assert(n_e > 0u && n_v > 0u);
+            --n_e;
+            --n_v;
+        }
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::update_boundary_face(const FaceHandle& _fh) {
+
+    const bool boundary = !face_deleted_[_fh.idx()] &&
+            (!incident_cell_per_hf_[halfface_handle(_fh, 0).idx()].is_valid() ||
+             !incident_cell_per_hf_[halfface_handle(_fh, 1).idx()].is_valid());
+
+    set_boundary_face(_fh, boundary);
+}
+
+//========================================================================================
+
+void TopologyKernel::enable_cell_vertex_table(bool _enable) {
+
+    if(_enable && !cell_vertex_table_enabled_) {
+        if(n_vertices_per_cell_ == 0u) {
+#ifndef NDEBUG
+            std::cerr << "enable_cell_vertex_table(): The cells of this mesh "
+                      << "do not have a fixed number of vertices!" << std::endl;
+#endif
+            return;
+        }
+        cell_vertex_table_enabled_ = true;
+        compute_cell_vertex_table();
+    }
+
+    if(!_enable) {
+        std::vector<int>().swap(cell_vertex_table_);
+        cell_vertex_table_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::enable_cell_neighbor_table(bool _enable) {
+
+    if(_enable && !cell_neighbor_table_enabled_) {
+        if(fixed_cell_valence_ == 0u) {
+#ifndef NDEBUG
+            std::cerr << "enable_cell_neighbor_table(): The cells of this mesh "
+                      << "do not have a fixed number of halffaces!" << std::endl;
+#endif
+            return;
+        }
+        cell_neighbor_table_enabled_ = true;
+        compute_cell_neighbor_table();
+    }
+
+    if(!_enable) {
+        std::vector<int>().swap(cell_neighbor_table_);
+        cell_neighbor_table_enabled_ = false;
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_cell_neighbor_table() {
+
+    if(!f_bottom_up_) return;
+
+    // With fixed valences, the halffaces of cell i are at i * fixed_cell_valence_
+    cell_neighbor_table_.resize(cell_halffaces_.size());
+
+    const int n = (int)cell_halffaces_.size();
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(effective_num_threads()) if(n >= 16384)
+#endif
+    for(int i = 0; i < n; ++i) {
+        cell_neighbor_table_[i] = incident_cell_per_hf_[opposite_halfface_handle(cell_halffaces_[i]).idx()].idx();
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::update_cell_neighbors(const CellHandle& _ch) {
+
+    const size_t offset = (size_t)_ch.idx() * fixed_cell_valence_;
+    assert(offset + fixed_cell_valence_ <= cell_neighbor_table_.size());
+
+    for(size_t i = offset; i < offset + fixed_cell_valence_; ++i) {
+        cell_neighbor_table_[i] = incident_cell_per_hf_[opposite_halfface_handle(cell_halffaces_[i]).idx()].idx();
+    }
+
+    // Update the entries of the neighbors that refer to _ch
+    for(size_t i = offset; i < offset + fixed_cell_valence_; ++i) {
+        const int nb = cell_neighbor_table_[i];
+        if(nb < 0) continue;
+        const size_t nb_offset = (size_t)nb * fixed_cell_valence_;
+        for(size_t j = nb_offset; j < nb_offset + fixed_cell_valence_; ++j) {
+            cell_neighbor_table_[j] = incident_cell_per_hf_[opposite_halfface_handle(cell_halffaces_[j]).idx()].idx();
+        }
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_cell_vertices(const CellHandle& /*_ch*/, int* /*_vertices*/) const {
+
+    // Only kernels with a fixed number of vertices per cell provide an order
+    assert(false);
+}
+
+//========================================================================================
+
+void TopologyKernel::compute_cell_vertex_table() {
+
+    const int n_cells = (int)this->n_cells();
+    cell_vertex_table_.resize((size_t)n_cells * n_vertices_per_cell_);
+
+    // The rows are independent of each other
+#ifdef USE_OPENMP
+    #pragma omp parallel for num_threads(effective_num_threads()) if(n_cells >= 4096)
+#endif
+    for(int i = 0; i < n_cells; ++i) {
+        if(cell_deleted_[i]) continue;
+        compute_cell_vertices(CellHandle(i), &cell_vertex_table_[(size_t)i * n_vertices_per_cell_]);
+    }
+}
+
+//========================================================================================
+
+void TopologyKernel::update_cell_vertex_table(const CellHandle& _ch) {
+
+    assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells());
+
+    if(cell_vertex_table_.size() < n_cells() * n_vertices_per_cell_) {
+        cell_vertex_table_.resize(n_cells() * n_vertices_per_cell_);
+    }
+    compute_cell_vertices(_ch, &cell_vertex_table_[(size_t)_ch.idx() * n_vertices_per_cell_]);
+}
+
+//========================================================================================
+
+int TopologyKernel::effective_num_threads() const {
+
+#ifdef USE_OPENMP
+    return n_threads_ > 0u ? (int)n_threads_ : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//========================================================================================
+
+// Emits both halfedges of each edge to the lists of their from-vertices
+class TopologyKernel::OutgoingHalfEdgeGenerator {
+public:
+    explicit OutgoingHalfEdgeGenerator(const TopologyKernel& _kernel) : kernel_(_kernel) {}
+
+    template <class Sink>
+    void operator()(size_t _i, Sink& _sink) const {
+
+        if(kernel_.edge_deleted_[_i]) return;
+
+        const Edge& e = kernel_.edges_[_i];
 
-        VertexHandle from = edges_[i].from_vertex();
         // If this condition is not fulfilled, it is out of caller's control and
         // definitely our bug, therefore an assert
-        assert((size_t)from.idx() < outgoing_hes_per_vertex_.size());
+        assert((size_t)e.from_vertex().idx() < kernel_.n_vertices());
+        assert((size_t)e.to_vertex().idx() < kernel_.n_vertices());
 
-        outgoing_hes_per_vertex_[from.idx()].push_back(halfedge_handle(EdgeHandle(i), 0));
-
-        VertexHandle to = edges_[i].to_vertex();
-        assert((size_t)to.idx() < outgoing_hes_per_vertex_.size());
+        _sink(e.from_vertex().idx(), HalfEdgeHandle(2 * (int)_i));
 
         // Store opposite halfedge handle
-        outgoing_hes_per_vertex_[to.idx()].push_back(halfedge_handle(EdgeHandle(i), 1));
+        _sink(e.to_vertex().idx(), HalfEdgeHandle(2 * (int)_i + 1));
     }
+
+private:
+    const TopologyKernel& kernel_;
+};
+
+void TopologyKernel::compute_vertex_bottom_up_incidences() {
+
+    outgoing_hes_per_vertex_.build(n_vertices(), edges_.size(),
+                                   OutgoingHalfEdgeGenerator(*this), effective_num_threads());
 }
 
 //========================================================================================
 
-void TopologyKernel::compute_edge_bottom_up_incidences() {
+// Emits both halffaces of each face to the lists of the face's halfedges
+class TopologyKernel::IncidentHalfFaceGenerator {
+public:
+    explicit IncidentHalfFaceGenerator(const TopologyKernel& _kernel) : kernel_(_kernel) {}
 
-    // Clear
-    incident_hfs_per_he_.clear();
-    incident_hfs_per_he_.resize(edges_.size() * 2u);
+    template <class Sink>
+    void operator()(size_t _i, Sink& _sink) const {
 
-    // Store incident halffaces per halfedge
-    int n_faces = (int)faces_.size();
-    for(int i = 0; i < n_faces; ++i) {
-        if (face_deleted_[i])
-            continue;
+        if(kernel_.face_deleted_[_i]) return;
 
-        std::vector<HalfEdgeHandle> halfedges = faces_[i].halfedges();
+        const HalfEdgeHandle* hes = &kernel_.face_halfedges_[kernel_.face_offsets_[_i]];
+        const unsigned int valence = kernel_.face_valences_[_i];
 
         // Go over all halfedges
-        for(std::vector<HalfEdgeHandle>::const_iterator he_it = halfedges.begin();
-                he_it != halfedges.end(); ++he_it) {
-
-            incident_hfs_per_he_[he_it->idx()].push_back(halfface_handle(FaceHandle(i), 0));
-            incident_hfs_per_he_[opposite_halfedge_handle(*he_it).idx()].push_back(
-                    halfface_handle(FaceHandle(i), 1));
+        for(unsigned int j = 0; j < valence; ++j) {
+            _sink(hes[j].idx(), HalfFaceHandle(2 * (int)_i));
+            _sink(kernel_.opposite_halfedge_handle(hes[j]).idx(), HalfFaceHandle(2 * (int)_i + 1));
         }
     }
+
+private:
+    const TopologyKernel& kernel_;
+};
+
+void TopologyKernel::compute_edge_bottom_up_incidences() {
+
+    incident_hfs_per_he_.build(edges_.size() * 2u, face_offsets_.size(),
+                               IncidentHalfFaceGenerator(*this), effective_num_threads());
 }
 
 //========================================================================================
@@ -2380,17 +4451,61 @@ void TopologyKernel::compute_face_bottom_up_incidences() {
 
     // Clear
     incident_cell_per_hf_.clear();
-    incident_cell_per_hf_.resize(faces_.size() * 2u, InvalidCellHandle);
+    incident_cell_per_hf_.resize(face_offsets_.size() * 2u, InvalidCellHandle);
+
+    int n_cells = (int)this->n_cells();
+
+#ifdef USE_OPENMP
+    // In a three-manifold mesh each halfface is written by at most one cell,
+    // so the cells can be processed in parallel. Afterwards each cell checks that
+    // it was not overwritten. If it was, the serial code below reproduces the
+    // first-come result and reports the problem.
+    const int n_threads = effective_num_threads();
+    if(n_threads > 1 && n_cells >= 4096 * n_threads) {
+
+        bool manifold = true;
+
+        #pragma omp parallel num_threads(n_threads)
+        {
+            #pragma omp for
+            for(int i = 0; i < n_cells; ++i) {
+                if (cell_deleted_[i])
+                    continue;
+
+                const Cell::HalfFaceView halffaces = cell(CellHandle(i)).halffaces();
+                for(Cell::HalfFaceView::const_iterator hf_it = halffaces.begin();
+                        hf_it != halffaces.end(); ++hf_it) {
+                    incident_cell_per_hf_[hf_it->idx()] = CellHandle(i);
+                }
+            }
+
+            #pragma omp for reduction(&&:manifold)
+            for(int i = 0; i < n_cells; ++i) {
+                if (cell_deleted_[i])
+                    continue;
+
+                const Cell::HalfFaceView halffaces = cell(CellHandle(i)).halffaces();
+                for(Cell::HalfFaceView::const_iterator hf_it = halffaces.begin();
+                        hf_it != halffaces.end(); ++hf_it) {
+                    manifold = manifold && (incident_cell_per_hf_[hf_it->idx()] == CellHandle(i));
+                }
+            }
+        }
+
+        if(manifold) return;
+
+        std::fill(incident_cell_per_hf_.begin(), incident_cell_per_hf_.end(), InvalidCellHandle);
+    }
+#endif
 
-    int n_cells = (int)cells_.size();
     for(int i = 0; i < n_cells; ++i) {
         if (cell_deleted_[i])
             continue;
 
-        std::vector<HalfFaceHandle> halffaces = cells_[i].halffaces();
+        const Cell::HalfFaceView halffaces = cell(CellHandle(i)).halffaces();
 
         // Go over all halffaces
-        for(std::vector<HalfFaceHandle>::const_iterator hf_it = halffaces.begin();
+        for(Cell::HalfFaceView::const_iterator hf_it = halffaces.begin();
                 hf_it != halffaces.end(); ++hf_it) {
 
             if(incident_cell_per_hf_[hf_it->idx()] == InvalidCellHandle) {
@@ -48,8 +48,15 @@
 #include <vector>
 
 #include "BaseEntities.hh"
+#include "EntityRange.hh"
+#include "HalfFaceCorner.hh"
+#include "HandleRemap.hh"
+#include "HashIndex.hh"
+#include "IncidenceArray.hh"
+#include "KRingScratch.hh"
 #include "OpenVolumeMeshHandle.hh"
 #include "ResourceManager.hh"
+#include "SmallVector.hh"
 #include "Iterators.hh"
 
 namespace OpenVolumeMesh {
@@ -201,6 +208,39 @@ public:
         return std::make_pair(begin, make_end_circulator(begin));
     }
 
+    /** \brief Collect all vertices within _k edges of vertex _vh
+     *
+     * The vertices are written to _out (which is cleared first) in order
+     * of their distance to _vh, _vh itself is not included. Requires the
+     * vertex bottom-up incidences.
+     *
+     * _scratch keeps the visited marks between queries, so repeated
+     * queries only cost time proportional to the result and do not
+     * allocate. Use one scratch object per thread.
+     */
+    void vertex_k_ring(const VertexHandle& _vh, unsigned int _k,
+                       std::vector<VertexHandle>& _out, KRingScratch& _scratch) const;
+
+    /// Same as above with a temporary scratch object (allocates memory for each query)
+    void vertex_k_ring(const VertexHandle& _vh, unsigned int _k, std::vector<VertexHandle>& _out) const {
+        KRingScratch scratch;
+        vertex_k_ring(_vh, _k, _out, scratch);
+    }
+
+    /** \brief Collect all cells that can be reached from cell _ch by crossing at most _k faces
+     *
+     * Works like vertex_k_ring() using the neighbors of CellCellIter.
+     * Requires the face bottom-up incidences.
+     */
+    void cell_k_ring(const CellHandle& _ch, unsigned int _k,
+                     std::vector<CellHandle>& _out, KRingScratch& _scratch) const;
+
+    /// Same as above with a temporary scratch object (allocates memory for each query)
+    void cell_k_ring(const CellHandle& _ch, unsigned int _k, std::vector<CellHandle>& _out) const {
+        KRingScratch scratch;
+        cell_k_ring(_ch, _k, _out, scratch);
+    }
+
     BoundaryHalfFaceHalfFaceIter bhfhf_iter(const HalfFaceHandle& _ref_h, int _max_laps = 1) const {
         return BoundaryHalfFaceHalfFaceIter(_ref_h, this, _max_laps);
     }
@@ -275,7 +315,7 @@ public:
     }
 
     FaceIter faces_end() const {
-        return FaceIter(this, FaceHandle((int)faces_.size()));
+        return FaceIter(this, FaceHandle((int)face_offsets_.size()));
     }
 
     std::pair<FaceIter, FaceIter> faces() const {
@@ -291,7 +331,7 @@ public:
     }
 
     HalfFaceIter halffaces_end() const {
-        return HalfFaceIter(this, HalfFaceHandle((int)faces_.size() * 2));
+        return HalfFaceIter(this, HalfFaceHandle((int)face_offsets_.size() * 2));
     }
 
     std::pair<HalfFaceIter, HalfFaceIter> halffaces() const {
@@ -307,13 +347,43 @@ public:
     }
 
     CellIter cells_end() const {
-        return CellIter(this, CellHandle((int)cells_.size()));
+        return CellIter(this, CellHandle((int)n_cells()));
     }
 
     std::pair<CellIter, CellIter> cells() const {
         return std::make_pair(cells_begin(), cells_end());
     }
 
+    /*
+     * Lightweight ranges of the non-deleted entities, which yield
+     * plain handles (see EntityRange). Adding or deleting entities
+     * invalidates them.
+     */
+
+    EntityRange<VertexHandle> vertex_range() const {
+        return EntityRange<VertexHandle>(vertex_deleted_);
+    }
+
+    EntityRange<EdgeHandle> edge_range() const {
+        return EntityRange<EdgeHandle>(edge_deleted_);
+    }
+
+    EntityRange<HalfEdgeHandle> halfedge_range() const {
+        return EntityRange<HalfEdgeHandle>(edge_deleted_, 1u);
+    }
+
+    EntityRange<FaceHandle> face_range() const {
+        return EntityRange<FaceHandle>(face_deleted_);
+    }
+
+    EntityRange<HalfFaceHandle> halfface_range() const {
+        return EntityRange<HalfFaceHandle>(face_deleted_, 1u);
+    }
+
+    EntityRange<CellHandle> cell_range() const {
+        return EntityRange<CellHandle>(cell_deleted_);
+    }
+
     /*
      * Virtual functions with implementation
      */
@@ -325,11 +395,13 @@ public:
     /// Get number of halfedges in mesh
     virtual size_t n_halfedges()  const { return edges_.size() * 2u; }
     /// Get number of faces in mesh
-    virtual size_t n_faces()      const { return faces_.size(); }
+    virtual size_t n_faces()      const { return face_offsets_.size(); }
     /// Get number of halffaces in mesh
-    virtual size_t n_halffaces()  const { return faces_.size() * 2u; }
+    virtual size_t n_halffaces()  const { return face_offsets_.size() * 2u; }
     /// Get number of cells in mesh
-    virtual size_t n_cells()      const { return cells_.size(); }
+    virtual size_t n_cells()      const {
+        return fixed_cell_valence_ ? cell_halffaces_.size() / fixed_cell_valence_ : cell_offsets_.size();
+    }
 
     int genus() const {
 
@@ -355,6 +427,11 @@ public:
     /// Add abstract vertex
     virtual VertexHandle add_vertex();
 
+    /// Add _n abstract vertices at once
+    ///
+    /// \return Handle of the first new vertex
+    virtual VertexHandle add_vertices(size_t _n);
+
     //=======================================================================
 
     /// Add edge
@@ -381,10 +458,42 @@ public:
     ///          the behavior is undefined.
     virtual CellHandle add_cell(const std::vector<HalfFaceHandle>& _halffaces, bool _topologyCheck = false);
 
-    /// Set the vertices of an edge
+    /// \brief Reserve memory for a mesh with the given numbers of entities
+    ///
+    /// Pre-sizes the entity arrays, the bottom-up incidences, the edge and
+    /// face indices (if enabled) and all properties, so that adding up to that
+    /// many entities does not reallocate. Face and cell storage assume an
+    /// average of four halfedges per face and six halffaces per cell, unless
+    /// the kernel has a fixed cell valence.
+    virtual void reserve(size_t _nv, size_t _ne, size_t _nf, size_t _nc);
+
+    /// \brief Add many cells at once, given by the vertices of their faces
+    ///
+    /// Cell i consists of the faces _cellFaceOffsets[i], ..., _cellFaceOffsets[i+1]-1
+    /// (_cellFaceOffsets has _nCells + 1 entries). Face j has the vertices
+    /// _faceVertices[_faceOffsets[j]], ..., _faceVertices[_faceOffsets[j+1]-1]
+    /// in connected order, so that its normal points into the cell.
+    ///
+    /// Edges and faces shared with other cells or already present in the mesh
+    /// are only created once. All handles are assigned in the same order as
+    /// if the faces and cells were added one after another, but properties
+    /// are resized and bottom-up incidences are computed only once.
+    /// No topology checks are performed.
+    ///
+    /// \return Handle of the first new cell
+    CellHandle add_cells(const int* _faceVertices, const size_t* _faceOffsets,
+                         const size_t* _cellFaceOffsets, size_t _nCells);
+
+    /// \brief Set the vertices of an edge
+    ///
+    /// The enabled indices, tables and incidences are updated for the
+    /// faces and cells around the edge only.
     void set_edge(const EdgeHandle& _eh, const VertexHandle& _fromVertex, const VertexHandle& _toVertex);
 
-    /// Set the half-edges of a face
+    /// \brief Set the half-edges of a face
+    ///
+    /// The enabled indices, tables and incidences are updated for the
+    /// face and its cells only.
     void set_face(const FaceHandle& _fh, const std::vector<HalfEdgeHandle>& _hes);
 
     /// Set the half-faces of a cell
@@ -398,20 +507,20 @@ public:
     const Edge& edge(const EdgeHandle& _edgeHandle) const;
 
     /// Get face with handle _faceHandle
-    const Face& face(const FaceHandle& _faceHandle) const;
+    ///
+    /// The returned face refers to the kernel's halfedge array,
+    /// so its halfedges() view is invalidated by topology changes.
+    Face face(const FaceHandle& _faceHandle) const;
 
     /// Get cell with handle _cellHandle
-    const Cell& cell(const CellHandle& _cellHandle) const;
+    ///
+    /// The returned cell refers to the kernel's halfface array,
+    /// so its halffaces() view is invalidated by topology changes.
+    Cell cell(const CellHandle& _cellHandle) const;
 
     /// Get edge with handle _edgeHandle
     Edge& edge(const EdgeHandle& _edgeHandle);
 
-    /// Get face with handle _faceHandle
-    Face& face(const FaceHandle& _faceHandle);
-
-    /// Get cell with handle _cellHandle
-    Cell& cell(const CellHandle& _cellHandle);
-
     /// Get edge that corresponds to halfedge with handle _halfEdgeHandle
     Edge halfedge(const HalfEdgeHandle& _halfEdgeHandle) const;
 
@@ -429,7 +538,8 @@ public:
 
     /// Get half-face from list of incident vertices (in connected order)
     ///
-    /// \note Only the first three vertices are checked
+    /// \note Only the first three vertices are checked, unless the face
+    ///       index is enabled and _vs contains all of the face's vertices
     HalfFaceHandle halfface(const std::vector<VertexHandle>& _vs) const;
 
     /// Get half-face from list of incident vertices (in connected order)
@@ -448,6 +558,40 @@ public:
     /// Get previous halfedge within a halfface
     HalfEdgeHandle prev_halfedge_in_halfface(const HalfEdgeHandle& _heh, const HalfFaceHandle& _hfh) const;
 
+    /// Get the corner of halfedge _heh in halfface _hfh (invalid if _heh is not part of _hfh)
+    HalfFaceCorner corner(const HalfEdgeHandle& _heh, const HalfFaceHandle& _hfh) const;
+
+    /// Get the halfedge at a corner
+    HalfEdgeHandle corner_halfedge(const HalfFaceCorner& _c) const {
+        assert(_c.is_valid() && (size_t)_c.halfface().idx() < face_offsets_.size() * 2u);
+        const int f = face_handle(_c.halfface()).idx();
+        const unsigned int n = face_valences_[f];
+        assert(_c.index() < n);
+        const HalfEdgeHandle* hes = &face_halfedges_[0] + face_offsets_[f];
+
+        // Odd halffaces traverse the face's halfedges backwards, in opposite direction
+        if(_c.halfface().idx() % 2 == 0) return hes[_c.index()];
+        return opposite_halfedge_handle(hes[n - 1u - _c.index()]);
+    }
+
+    /// Get the corner of the next halfedge within the halfface
+    HalfFaceCorner next_corner(const HalfFaceCorner& _c) const {
+        const unsigned int n = corner_valence(_c);
+        return HalfFaceCorner(_c.halfface(), (_c.index() + 1u == n) ? 0u : _c.index() + 1u);
+    }
+
+    /// Get the corner of the previous halfedge within the halfface
+    HalfFaceCorner prev_corner(const HalfFaceCorner& _c) const {
+        const unsigned int n = corner_valence(_c);
+        return HalfFaceCorner(_c.halfface(), (_c.index() == 0u) ? n - 1u : _c.index() - 1u);
+    }
+
+    /// Get the corner of the opposite halfedge within the opposite halfface
+    HalfFaceCorner opposite_corner(const HalfFaceCorner& _c) const {
+        const unsigned int n = corner_valence(_c);
+        return HalfFaceCorner(opposite_halfface_handle(_c.halfface()), n - 1u - _c.index());
+    }
+
     /// Get valence of vertex (number of incident edges)
     inline size_t valence(const VertexHandle& _vh) const {
         assert(has_vertex_bottom_up_incidences());
@@ -467,16 +611,16 @@ public:
 
     /// Get valence of face (number of incident edges)
     inline size_t valence(const FaceHandle& _fh) const {
-        assert(_fh.is_valid() && (size_t)_fh.idx() < faces_.size());
+        assert(_fh.is_valid() && (size_t)_fh.idx() < face_offsets_.size());
 
-        return face(_fh).halfedges().size();
+        return face_valences_[_fh.idx()];
     }
 
     /// Get valence of cell (number of incident faces)
     inline size_t valence(const CellHandle& _ch) const {
-        assert(_ch.is_valid() && (size_t)_ch.idx() < cells_.size());
+        assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells());
 
-        return cell(_ch).halffaces().size();
+        return fixed_cell_valence_ ? fixed_cell_valence_ : cell_valences_[_ch.idx()];
     }
 
     //=====================================================================
@@ -495,6 +639,18 @@ public:
 
     virtual void collect_garbage();
 
+    /// Same as collect_garbage(), additionally stores where the entities went in _remap
+    void collect_garbage(HandleRemap& _remap);
+
+    /// Delete the tagged entities and all entities incident to them
+    /// in one linear pass, keeping the order of the remaining ones.
+    /// If _remap is given, it receives the new index of each entity.
+    void delete_tagged(const std::vector<bool>& _vertexTags,
+                       const std::vector<bool>& _edgeTags,
+                       const std::vector<bool>& _faceTags,
+                       const std::vector<bool>& _cellTags,
+                       HandleRemap* _remap = 0);
+
 
     virtual bool is_deleted(const VertexHandle& _h)   const { return vertex_deleted_[_h.idx()]; }
     virtual bool is_deleted(const EdgeHandle& _h)     const { return edge_deleted_[_h.idx()];   }
@@ -540,6 +696,15 @@ protected:
 
     virtual void delete_multiple_cells(const std::vector<bool>& _tag);
 
+    /// New index of each untagged entity, -1 for the tagged ones
+    size_t compute_new_indices(const std::vector<bool>& _tag, std::vector<int>& _newIndices) const;
+
+    /// Drop the tagged entities from the bottom-up incidences and renumber the remaining ones
+    void delete_multiple_bottom_up_incidences(const std::vector<bool>& _vertexTags,
+                                              const std::vector<bool>& _edgeTags,
+                                              const HandleRemap& _remap,
+                                              bool _vertices, bool _edges, bool _faces);
+
     class EdgeCorrector {
     public:
         EdgeCorrector(const std::vector<int>& _newIndices) :
@@ -558,16 +723,10 @@ protected:
         FaceCorrector(const std::vector<int>& _newIndices) :
             newIndices_(_newIndices) {}
 
-        void operator()(Face& _face) {
-            std::vector<HalfEdgeHandle> hes = _face.halfedges();
-            for(std::vector<HalfEdgeHandle>::iterator he_it = hes.begin(),
-                    he_end = hes.end(); he_it != he_end; ++he_it) {
-
-                EdgeHandle eh = edge_handle(*he_it);
-                unsigned char opp = (he_it->idx() - halfedge_handle(eh, 0).idx());
-                *he_it = halfedge_handle(newIndices_[eh.idx()], opp);
-            }
-            _face.set_halfedges(hes);
+        void operator()(HalfEdgeHandle& _he) {
+            EdgeHandle eh = edge_handle(_he);
+            unsigned char opp = (_he.idx() - halfedge_handle(eh, 0).idx());
+            _he = halfedge_handle(newIndices_[eh.idx()], opp);
         }
     private:
         const std::vector<int>& newIndices_;
@@ -578,16 +737,10 @@ protected:
         CellCorrector(const std::vector<int>& _newIndices) :
             newIndices_(_newIndices) {}
 
-        void operator()(Cell& _cell) {
-            std::vector<HalfFaceHandle> hfs = _cell.halffaces();
-            for(std::vector<HalfFaceHandle>::iterator hf_it = hfs.begin(),
-                    hf_end = hfs.end(); hf_it != hf_end; ++hf_it) {
-
-                FaceHandle fh = face_handle(*hf_it);
-                unsigned char opp = (hf_it->idx() - halfface_handle(fh, 0).idx());
-                *hf_it = halfface_handle(newIndices_[fh.idx()], opp);
-            }
-            _cell.set_halffaces(hfs);
+        void operator()(HalfFaceHandle& _hf) {
+            FaceHandle fh = face_handle(_hf);
+            unsigned char opp = (_hf.idx() - halfface_handle(fh, 0).idx());
+            _hf = halfface_handle(newIndices_[fh.idx()], opp);
         }
     private:
         const std::vector<int>& newIndices_;
@@ -611,8 +764,22 @@ public:
     virtual void clear(bool _clearProps = true) {
 
         edges_.clear();
-        faces_.clear();
-        cells_.clear();
+        edge_index_.clear();
+        face_index_.clear();
+        cell_vertex_table_.clear();
+        cell_neighbor_table_.clear();
+        face_offsets_.clear();
+        face_valences_.clear();
+        face_halfedges_.clear();
+        n_unused_face_halfedges_ = 0;
+        cell_offsets_.clear();
+        cell_valences_.clear();
+        cell_halffaces_.clear();
+        n_unused_cell_halffaces_ = 0;
+        free_vertices_.clear();
+        free_edges_.clear();
+        free_faces_.clear();
+        free_cells_.clear();
         vertex_deleted_.clear();
         edge_deleted_.clear();
         face_deleted_.clear();
@@ -620,6 +787,12 @@ public:
         outgoing_hes_per_vertex_.clear();
         incident_hfs_per_he_.clear();
         incident_cell_per_hf_.clear();
+        incident_cells_per_vertex_.clear();
+        adjacent_hf_per_cell_.clear();
+        boundary_face_pos_.clear();
+        boundary_faces_.clear();
+        n_boundary_faces_per_edge_.clear();
+        n_boundary_faces_per_vertex_.clear();
         n_vertices_ = 0;
 
         if(_clearProps) {
@@ -678,15 +851,7 @@ public:
             compute_edge_bottom_up_incidences();
 
             if(f_bottom_up_) {
-#if defined(__clang_major__) && (__clang_major__ >= 5)
-                for(EdgeIter e_it = edges_begin(), e_end = edges_end();
-                    e_it != e_end; ++e_it) {
-                    reorder_incident_halffaces(*e_it);
-                }
-#else
-                std::for_each(edges_begin(), edges_end(),
-                              fun::bind(&TopologyKernel::reorder_incident_halffaces, this, fun::placeholders::_1));
-#endif
+                reorder_all_incident_halffaces();
             }
         }
 
@@ -716,15 +881,13 @@ public:
 
         if(updateOrder) {
             if(e_bottom_up_) {
-#if defined(__clang_major__) && (__clang_major__ >= 5)
-                for(EdgeIter e_it = edges_begin(), e_end = edges_end();
-                    e_it != e_end; ++e_it) {
-                    reorder_incident_halffaces(*e_it);
-                }
-#else
-                std::for_each(edges_begin(), edges_end(),
-                              fun::bind(&TopologyKernel::reorder_incident_halffaces, this, fun::placeholders::_1));
-#endif
+                reorder_all_incident_halffaces();
+            }
+            if(boundary_index_enabled_) {
+                compute_boundary_index();
+            }
+            if(cell_neighbor_table_enabled_) {
+                compute_cell_neighbor_table();
             }
         }
     }
@@ -749,6 +912,188 @@ public:
     void enable_fast_deletion(bool _enable = true) { fast_deletion = _enable; }
     bool fast_deletion_enabled() const { return fast_deletion; }
 
+    /// \brief Reuse the slots of deleted entities
+    ///
+    /// With deferred deletion, add_vertex(), add_edge(), add_face() and
+    /// add_cell() take the slot of a deleted entity of the same type
+    /// if there is one, with its properties reset to their default values.
+    /// If entities are deleted and added in turns, the memory footprint
+    /// thus stays the same without collecting the garbage in between.
+    /// Note that a handle of a deleted entity may then refer to a new one.
+    /// add_vertices() and add_cells() always append.
+    void enable_slot_reuse(bool _enable = true);
+    bool has_slot_reuse() const { return slot_reuse_enabled_; }
+
+    /// \brief Maintain a hash index on the vertex pairs of all edges
+    ///
+    /// With the index, the duplicate check in add_edge() and
+    /// halfedge(const VertexHandle&, const VertexHandle&) take constant
+    /// time, independent of the bottom-up incidences.
+    /// Edges must not be modified through edge() while it is enabled.
+    void enable_edge_index(bool _enable = true);
+    bool has_edge_index() const { return edge_index_enabled_; }
+
+    /// \brief Maintain a hash index on the vertex sets of all faces
+    ///
+    /// With the index, halfface(const std::vector<VertexHandle>&) and
+    /// halfface_extensive() find a face by its vertices in constant time.
+    /// Modify faces only through set_face() and set_edge() while it is
+    /// enabled, they re-hash the affected faces.
+    void enable_face_index(bool _enable = true);
+    bool has_face_index() const { return face_index_enabled_; }
+
+    /// \brief Maintain the incident cells of each vertex
+    ///
+    /// With these incidences, VertexCellIter and the vertex stars in
+    /// TetrahedralMeshTopologyKernel::collapse_edge() are read from a
+    /// list instead of being gathered via the incident halfedges and
+    /// halffaces. The lists are updated whenever cells are added or removed.
+    void enable_vertex_cell_incidences(bool _enable = true);
+    bool has_vertex_cell_incidences() const { return vc_incidences_enabled_; }
+
+    /// The cells incident to vertex _vh in no particular order (requires the vertex-cell incidences)
+    ConstArrayView<CellHandle> incident_cells(const VertexHandle& _vh) const {
+        assert(vc_incidences_enabled_);
+        assert(_vh.is_valid() && (size_t)_vh.idx() < incident_cells_per_vertex_.size());
+        return incident_cells_per_vertex_[_vh.idx()];
+    }
+
+    /// \brief Maintain the halfface adjacencies within each cell
+    ///
+    /// Stores for every halfface of a cell and each of its halfedges the
+    /// other halfface of the cell that shares the edge, so
+    /// adjacent_halfface_in_cell() (and the circulators and the halfface
+    /// reordering built on it) only has to look at the given halfface.
+    /// Each cell's entries are computed when the cell is added or changed.
+    void enable_cell_halfface_adjacency(bool _enable = true);
+    bool has_cell_halfface_adjacency() const { return hf_adjacency_enabled_; }
+
+    /// \brief Maintain the set of boundary faces
+    ///
+    /// Keeps a list of all boundary faces and the number of incident
+    /// boundary faces per edge and per vertex, so is_boundary() takes
+    /// constant time for all entity types and BoundaryFaceIter only visits
+    /// the boundary faces. Requires the face bottom-up incidences; while
+    /// they are disabled, the index is not updated and it is recomputed
+    /// once they are enabled again.
+    void enable_boundary_index(bool _enable = true);
+    bool has_boundary_index() const { return boundary_index_enabled_; }
+
+    /// All boundary faces in no particular order (requires the boundary index)
+    const std::vector<FaceHandle>& boundary_faces() const {
+        assert(boundary_index_enabled_ && f_bottom_up_);
+        return boundary_faces_;
+    }
+
+    /// \brief Maintain a table of the vertices of all cells
+    ///
+    /// Only available if all cells have the same number of vertices
+    /// (tetrahedral and hexahedral meshes). The vertices of each cell are
+    /// stored in the order of TetVertexIter / HexVertexIter and are kept
+    /// up to date by all operations that modify the mesh.
+    void enable_cell_vertex_table(bool _enable = true);
+    bool has_cell_vertex_table() const { return cell_vertex_table_enabled_; }
+
+    /// Number of vertices of each cell, zero if it is not the same for all cells
+    unsigned int n_vertices_per_cell() const { return n_vertices_per_cell_; }
+
+    /// \brief The vertex indices of all cells, n_vertices_per_cell() entries per cell
+    ///
+    /// The entries of deleted cells are undefined. Requires the cell vertex table.
+    const int* cell_vertex_table() const {
+        assert(cell_vertex_table_enabled_);
+        return cell_vertex_table_.empty() ? 0 : &cell_vertex_table_[0];
+    }
+
+    /// The _i-th vertex of cell _ch (requires the cell vertex table)
+    VertexHandle cell_vertex(const CellHandle& _ch, unsigned int _i) const {
+        assert(cell_vertex_table_enabled_);
+        assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells() && _i < n_vertices_per_cell_);
+        return VertexHandle(cell_vertex_table_[(size_t)_ch.idx() * n_vertices_per_cell_ + _i]);
+    }
+
+    /// \brief Maintain a table of the neighbors of all cells
+    ///
+    /// Only available if all cells have the same number of halffaces
+    /// (tetrahedral and hexahedral meshes). Stores for each halfface of a
+    /// cell the cell on its other side, so cell_neighbor() is a single array
+    /// access. Requires the face bottom-up incidences; while they are
+    /// disabled, the table is not updated and it is recomputed once they
+    /// are enabled again.
+    void enable_cell_neighbor_table(bool _enable = true);
+    bool has_cell_neighbor_table() const { return cell_neighbor_table_enabled_; }
+
+    /// Number of halffaces of each cell, zero if it is not the same for all cells
+    unsigned int n_halffaces_per_cell() const { return fixed_cell_valence_; }
+
+    /// \brief The neighbor indices of all cells, one entry per halfface in the order of
+    ///        cell(ch).halffaces(), -1 on the boundary
+    ///
+    /// The entries of deleted cells are undefined. Requires the cell neighbor table.
+    const int* cell_neighbor_table() const {
+        assert(cell_neighbor_table_enabled_ && f_bottom_up_);
+        return cell_neighbor_table_.empty() ? 0 : &cell_neighbor_table_[0];
+    }
+
+    /// The cell on the other side of the _i-th halfface of cell _ch (requires the cell neighbor table)
+    CellHandle cell_neighbor(const CellHandle& _ch, unsigned int _i) const {
+        assert(cell_neighbor_table_enabled_ && f_bottom_up_);
+        assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells() && _i < fixed_cell_valence_);
+        return CellHandle(cell_neighbor_table_[(size_t)_ch.idx() * fixed_cell_valence_ + _i]);
+    }
+
+    /// \brief Set the number of threads used to compute the bottom-up incidences
+    ///
+    /// 0 uses the OpenMP default. The result does not depend on the number
+    /// of threads. Without OpenMP support the incidences are always computed serially.
+    void set_num_threads(unsigned int _n) { n_threads_ = _n; }
+    unsigned int num_threads() const { return n_threads_; }
+
+    /** \brief Call _f(h) for all handles h of _range in parallel
+     *
+     * The handles are split into chunks of _chunk_size consecutive indices,
+     * which are handed out to the threads on demand, so uneven work per
+     * entity is balanced. Deleted entities are skipped. The number of
+     * threads is set via set_num_threads(). Without OpenMP support, the
+     * loop runs serially.
+     *
+     * All threads share _f, so calling it has to be thread-safe for
+     * distinct handles. The kernel must not be modified meanwhile.
+     */
+    template <class HandleT, class FuncT>
+    void parallel_for(const EntityRange<HandleT>& _range, const FuncT& _f, int _chunk_size = 1024) const;
+
+    template <class FuncT>
+    void parallel_for_vertices(const FuncT& _f, int _chunk_size = 1024) const {
+        parallel_for(vertex_range(), _f, _chunk_size);
+    }
+
+    template <class FuncT>
+    void parallel_for_edges(const FuncT& _f, int _chunk_size = 1024) const {
+        parallel_for(edge_range(), _f, _chunk_size);
+    }
+
+    template <class FuncT>
+    void parallel_for_faces(const FuncT& _f, int _chunk_size = 1024) const {
+        parallel_for(face_range(), _f, _chunk_size);
+    }
+
+    template <class FuncT>
+    void parallel_for_cells(const FuncT& _f, int _chunk_size = 1024) const {
+        parallel_for(cell_range(), _f, _chunk_size);
+    }
+
+    /** \brief Combine the values _map(h) of all handles h of _range in parallel
+     *
+     * _identity has to be the neutral element of the associative operation
+     * _reduce(ValueT, ValueT). Each chunk (see parallel_for()) is reduced
+     * on its own and the chunk results are combined in order, so the
+     * result does not depend on the number of threads.
+     */
+    template <class HandleT, class ValueT, class MapT, class ReduceT>
+    ValueT parallel_reduce(const EntityRange<HandleT>& _range, const ValueT& _identity,
+                           const MapT& _map, const ReduceT& _reduce, int _chunk_size = 1024) const;
+
 
 protected:
 
@@ -760,15 +1105,134 @@ protected:
 
     void reorder_incident_halffaces(const EdgeHandle& _eh);
 
+    // Same as above, using the given buffers as scratch space
+    void reorder_incident_halffaces(const EdgeHandle& _eh,
+                                    std::vector<HalfFaceHandle>& _forward,
+                                    std::vector<HalfFaceHandle>& _backward);
+
+    // Reorder the incident halffaces of all edges (in parallel if possible)
+    void reorder_all_incident_halffaces();
+
+    // Number of threads to use in parallel sections (at least 1)
+    int effective_num_threads() const;
+
+    // Rebuild the edge index from scratch
+    void compute_edge_index();
+
+    // Hash value of the unordered vertex pair of an edge
+    static size_t edge_hash(const VertexHandle& _vh1, const VertexHandle& _vh2);
+
+    // Index of an edge between the two vertices or -1 (requires the edge index)
+    int find_edge(const VertexHandle& _vh1, const VertexHandle& _vh2) const;
+
+    class EdgeMatch;
+
+    // Rebuild the face index from scratch
+    void compute_face_index();
+
+    // Hash value of the vertex set of a face, independent of the order of the vertices
+    static size_t face_hash(const std::vector<VertexHandle>& _vs);
+    size_t face_hash(const FaceHandle& _fh) const;
+
+    // Compare the vertices of face _fh to _vs: 0 if _vs has the same cyclic order
+    // as the face, 1 if it has the opposite order and -1 if the vertices differ
+    int match_face_vertices(const FaceHandle& _fh, const std::vector<VertexHandle>& _vs) const;
+
+    // Halfface with exactly the vertices _vs (in connected order) (requires the face index)
+    HalfFaceHandle find_halfface(const std::vector<VertexHandle>& _vs) const;
+
+    class FaceMatch;
+
+    // Rebuild the vertex-cell incidences from scratch
+    void compute_vertex_cell_incidences();
+
+    // Distinct vertices of cell _ch in ascending order
+    typedef SmallVector<VertexHandle, 16> CellVertexSet;
+    void get_cell_vertex_set(const CellHandle& _ch, CellVertexSet& _vs) const;
+
+    // Add cell _ch to / remove it from the lists of its vertices
+    void add_vertex_cell_incidences(const CellHandle& _ch);
+    void remove_vertex_cell_incidences(const CellHandle& _ch);
+
+    // Entry generator for the vertex-cell incidences
+    class IncidentCellGenerator;
+
+    // Rebuild the halfface adjacencies of all cells
+    void compute_cell_halfface_adjacency();
+
+    // Recompute the halfface adjacencies of cell _ch
+    void update_cell_halfface_adjacency(const CellHandle& _ch);
+
+    // Entry generator for the halfface adjacencies
+    class HalfFaceAdjacencyGenerator;
+
+    // Marks halfedges without an adjacent halfface in the cell
+    static const unsigned char NoAdjacentHalfFace = 255u;
+
+    // Number of halfedges of a corner's halfface
+    unsigned int corner_valence(const HalfFaceCorner& _c) const {
+        assert(_c.is_valid() && (size_t)_c.halfface().idx() < face_offsets_.size() * 2u);
+        assert(_c.index() < face_valences_[face_handle(_c.halfface()).idx()]);
+        return face_valences_[face_handle(_c.halfface()).idx()];
+    }
+
+    // Rebuild the cell neighbor table from scratch (if the face bottom-up incidences are available)
+    void compute_cell_neighbor_table();
+
+    // Recompute the neighbors of cell _ch and of the cells adjacent to it
+    void update_cell_neighbors(const CellHandle& _ch);
+
+    // Whether the cell neighbor table has to be updated by modifications
+    bool cell_neighbor_table_valid() const { return cell_neighbor_table_enabled_ && f_bottom_up_; }
+
+    // Rebuild the boundary index from scratch (if the face bottom-up incidences are available)
+    void compute_boundary_index();
+
+    // Add face _fh to or remove it from the boundary faces
+    void set_boundary_face(const FaceHandle& _fh, bool _boundary);
+
+    // Recompute whether face _fh is a boundary face
+    void update_boundary_face(const FaceHandle& _fh);
+
+    // Whether the boundary index has to be updated by modifications
+    bool boundary_index_valid() const { return boundary_index_enabled_ && f_bottom_up_; }
+
+    // Write the n_vertices_per_cell_ vertices of cell _ch in table order to _vertices
+    virtual void compute_cell_vertices(const CellHandle& _ch, int* _vertices) const;
+
+    // Rebuild the cell vertex table from scratch
+    void compute_cell_vertex_table();
+
+    // Recompute the table entries of cell _ch (appends a row for a new cell)
+    void update_cell_vertex_table(const CellHandle& _ch);
+
+    // Vertex that halfedge _heh starts at
+    VertexHandle halfedge_from_vertex(const HalfEdgeHandle& _heh) const {
+        const Edge& e = edges_[_heh.idx() / 2];
+        return (_heh.idx() & 1) ? e.to_vertex() : e.from_vertex();
+    }
+
+    // Entry generators for IncidenceArray::build()
+    class OutgoingHalfEdgeGenerator;
+    class IncidentHalfFaceGenerator;
+
     // Outgoing halfedges per vertex
-    std::vector<std::vector<HalfEdgeHandle> > outgoing_hes_per_vertex_;
+    IncidenceArray<HalfEdgeHandle> outgoing_hes_per_vertex_;
 
     // Incident halffaces per (directed) halfedge
-    std::vector<std::vector<HalfFaceHandle> > incident_hfs_per_he_;
+    IncidenceArray<HalfFaceHandle> incident_hfs_per_he_;
 
     // Incident cell (at most one) per halfface
     std::vector<CellHandle> incident_cell_per_hf_;
 
+    // Incident cells per vertex (only if enabled)
+    IncidenceArray<CellHandle> incident_cells_per_vertex_;
+
+    // Per cell, for each of its halffaces and each halfedge of the
+    // halfface's face (in stored order): the position of the adjacent
+    // halfface within the cell (only if enabled)
+    IncidenceArray<unsigned char> adjacent_hf_per_cell_;
+
 private:
     bool v_bottom_up_;
 
@@ -780,6 +1244,52 @@ private:
 
     bool fast_deletion;
 
+    bool slot_reuse_enabled_;
+
+    // Deleted entities whose slots are used again first (only if enabled)
+    std::vector<int> free_vertices_;
+    std::vector<int> free_edges_;
+    std::vector<int> free_faces_;
+    std::vector<int> free_cells_;
+
+    unsigned int n_threads_;
+
+    bool edge_index_enabled_;
+
+    // Edges by their (unordered) vertex pairs
+    HashIndex edge_index_;
+
+    bool face_index_enabled_;
+
+    // Faces by their vertex sets
+    HashIndex face_index_;
+
+    bool vc_incidences_enabled_;
+
+    bool hf_adjacency_enabled_;
+
+    bool boundary_index_enabled_;
+
+    // Position of each face in boundary_faces_, -1 for faces that are not on the boundary
+    std::vector<int> boundary_face_pos_;
+
+    // All boundary faces
+    std::vector<FaceHandle> boundary_faces_;
+
+    // Number of incident boundary faces per edge and per vertex
+    std::vector<unsigned int> n_boundary_faces_per_edge_;
+    std::vector<unsigned int> n_boundary_faces_per_vertex_;
+
+    bool cell_vertex_table_enabled_;
+
+    // Vertices of all cells, n_vertices_per_cell_ entries per cell
+    std::vector<int> cell_vertex_table_;
+
+    bool cell_neighbor_table_enabled_;
+
+    // Neighbors of all cells, fixed_cell_valence_ entries per cell
+    std::vector<int> cell_neighbor_table_;
+
     //=====================================================================
     // Connectivity
     //=====================================================================
@@ -799,22 +1309,28 @@ public:
 
     bool is_boundary(const HalfFaceHandle& _halfFaceHandle) const {
 
-        assert(_halfFaceHandle.is_valid() && (size_t)_halfFaceHandle.idx() < faces_.size() * 2u);
+        assert(_halfFaceHandle.is_valid() && (size_t)_halfFaceHandle.idx() < face_offsets_.size() * 2u);
         assert(has_face_bottom_up_incidences());
         assert((size_t)_halfFaceHandle.idx() < incident_cell_per_hf_.size());
         return incident_cell_per_hf_[_halfFaceHandle.idx()] == InvalidCellHandle;
     }
 
     bool is_boundary(const FaceHandle& _faceHandle) const {
-        assert(_faceHandle.is_valid() && (size_t)_faceHandle.idx() < faces_.size());
+        assert(_faceHandle.is_valid() && (size_t)_faceHandle.idx() < face_offsets_.size());
         assert(has_face_bottom_up_incidences());
+        if(boundary_index_enabled_) {
+            return boundary_face_pos_[_faceHandle.idx()] >= 0;
+        }
         return  is_boundary(halfface_handle(_faceHandle, 0)) ||
                 is_boundary(halfface_handle(_faceHandle, 1));
     }
 
     bool is_boundary(const EdgeHandle& _edgeHandle) const {
-        assert(has_edge_bottom_up_incidences());
         assert(_edgeHandle.is_valid() && (size_t)_edgeHandle.idx() < edges_.size());
+        if(boundary_index_enabled_ && f_bottom_up_) {
+            return n_boundary_faces_per_edge_[_edgeHandle.idx()] > 0u;
+        }
+        assert(has_edge_bottom_up_incidences());
 
         for(HalfEdgeHalfFaceIter hehf_it = hehf_iter(halfedge_handle(_edgeHandle, 0));
                 hehf_it.valid(); ++hehf_it) {
@@ -826,8 +1342,11 @@ public:
     }
 
     bool is_boundary(const HalfEdgeHandle& _halfedgeHandle) const {
-        assert(has_edge_bottom_up_incidences());
         assert(_halfedgeHandle.is_valid() && (size_t)_halfedgeHandle.idx() < edges_.size() * 2u);
+        if(boundary_index_enabled_ && f_bottom_up_) {
+            return n_boundary_faces_per_edge_[_halfedgeHandle.idx() / 2] > 0u;
+        }
+        assert(has_edge_bottom_up_incidences());
 
         for(HalfEdgeHalfFaceIter hehf_it = hehf_iter(_halfedgeHandle);
                 hehf_it.valid(); ++hehf_it) {
@@ -839,8 +1358,11 @@ public:
     }
 
     bool is_boundary(const VertexHandle& _vertexHandle) const {
-        assert(has_vertex_bottom_up_incidences());
         assert(_vertexHandle.is_valid() && (size_t)_vertexHandle.idx() < n_vertices());
+        if(boundary_index_enabled_ && f_bottom_up_) {
+            return n_boundary_faces_per_vertex_[_vertexHandle.idx()] > 0u;
+        }
+        assert(has_vertex_bottom_up_incidences());
 
         for(VertexOHalfEdgeIter voh_it = voh_iter(_vertexHandle); voh_it.valid(); ++voh_it) {
             if(is_boundary(*voh_it)) return true;
@@ -849,7 +1371,7 @@ public:
     }
 
     size_t n_vertices_in_cell(const CellHandle& _ch) const {
-        assert(_ch.is_valid() && (size_t)_ch.idx() < cells_.size());
+        assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells());
 
         std::set<VertexHandle> vertices;
         std::vector<HalfFaceHandle> hfs = cell(_ch).halffaces();
@@ -875,13 +1397,15 @@ public:
     }
 
     Face opposite_halfface(const Face& _face) const {
-        std::vector<HalfEdgeHandle> opp_halfedges;
-        for(std::vector<HalfEdgeHandle>::const_iterator it = _face.halfedges().begin(); it
-                != _face.halfedges().end(); ++it) {
-            opp_halfedges.insert(opp_halfedges.begin(), opposite_halfedge_handle(*it));
+        Face::HalfEdgeView hes = _face.halfedges();
+        SmallVector<HalfEdgeHandle, 8> opp_halfedges;
+        for(size_t i = hes.size(); i > 0; --i) {
+            opp_halfedges.push_back(opposite_halfedge_handle(hes[i - 1]));
         }
 
-        return Face(opp_halfedges);
+        Face opp(0, 0);
+        opp.set_halfedges(opp_halfedges.begin(), opp_halfedges.size());
+        return opp;
     }
 
     /*
@@ -954,20 +1478,102 @@ protected:
     // List of edges
     std::vector<Edge> edges_;
 
-    // List of faces
-    std::vector<Face> faces_;
+    /*
+     * Face storage: The halfedges of all faces are kept in
+     * one contiguous array. The halfedges of face i are
+     * face_halfedges_[face_offsets_[i], face_offsets_[i] + face_valences_[i]).
+     * Slots that are no longer referenced by any face are
+     * reclaimed by compact_face_halfedges().
+     */
+
+    /// Store the halfedges of face _fh (reuses its slots if the valence did not change)
+    void store_face_halfedges(const FaceHandle& _fh, const std::vector<HalfEdgeHandle>& _hes);
+
+    /// Mark the slots of a face that has been removed as unused
+    void release_face_halfedges(size_t _offset, size_t _valence);
 
-    // List of cells
-    std::vector<Cell> cells_;
+    /// Rewrite the halfedge array in face order, dropping unused slots
+    void compact_face_halfedges();
 
-    std::vector<bool> vertex_deleted_;
-    std::vector<bool> edge_deleted_;
-    std::vector<bool> face_deleted_;
-    std::vector<bool> cell_deleted_;
+    /// Direct access to the stored halfedges of face _fh
+    HalfEdgeHandle* face_halfedges_begin(const FaceHandle& _fh) {
+        assert(_fh.is_valid() && (size_t)_fh.idx() < face_offsets_.size());
+        return face_halfedges_.empty() ? 0 : &face_halfedges_[0] + face_offsets_[_fh.idx()];
+    }
+
+    // Offset of each face's first halfedge in face_halfedges_
+    std::vector<size_t> face_offsets_;
+
+    // Number of halfedges of each face
+    std::vector<unsigned int> face_valences_;
+
+    // Halfedges of all faces
+    std::vector<HalfEdgeHandle> face_halfedges_;
+
+    // Number of entries in face_halfedges_ not referenced by any face
+    size_t n_unused_face_halfedges_;
+
+    /*
+     * Cell storage: Same layout as the face storage. If
+     * fixed_cell_valence_ is nonzero, every cell has exactly
+     * that many halffaces which are packed back to back, i.e. the
+     * halffaces of cell i start at cell_halffaces_[i * fixed_cell_valence_],
+     * and cell_offsets_ and cell_valences_ are not used.
+     */
+
+    /// Store all cells with _valence halffaces without offsets (only possible on an empty mesh)
+    void set_fixed_cell_valence(unsigned int _valence);
+
+    /// Store the halffaces of cell _ch (reuses its slots if the valence did not change)
+    void store_cell_halffaces(const CellHandle& _ch, const std::vector<HalfFaceHandle>& _hfs);
+
+    /// Mark the slots of a cell that has been removed as unused
+    void release_cell_halffaces(size_t _offset, size_t _valence);
+
+    /// Rewrite the halfface array in cell order, dropping unused slots
+    void compact_cell_halffaces();
+
+    /// Offset of the first halfface of cell _ch in cell_halffaces_
+    size_t cell_offset(const CellHandle& _ch) const {
+        assert(_ch.is_valid() && (size_t)_ch.idx() < n_cells());
+        return fixed_cell_valence_ ? (size_t)_ch.idx() * fixed_cell_valence_ : cell_offsets_[_ch.idx()];
+    }
+
+    /// Direct access to the stored halffaces of cell _ch
+    HalfFaceHandle* cell_halffaces_begin(const CellHandle& _ch) {
+        return cell_halffaces_.empty() ? 0 : &cell_halffaces_[0] + cell_offset(_ch);
+    }
+
+    // Offset of each cell's first halfface in cell_halffaces_
+    std::vector<size_t> cell_offsets_;
+
+    // Number of halffaces of each cell
+    std::vector<unsigned int> cell_valences_;
+
+    // Halffaces of all cells
+    std::vector<HalfFaceHandle> cell_halffaces_;
+
+    // Number of entries in cell_halffaces_ not referenced by any cell
+    size_t n_unused_cell_halffaces_;
+
+    // Number of halffaces per cell if all cells have the same valence, zero otherwise
+    unsigned int fixed_cell_valence_;
+
+    // Number of vertices per cell if it is the same for all cells, zero otherwise
+    unsigned int n_vertices_per_cell_;
+
+    DeletionMask vertex_deleted_;
+    DeletionMask edge_deleted_;
+    DeletionMask face_deleted_;
+    DeletionMask cell_deleted_;
     bool needs_garbage_collection_;
 
 };
 
 }
 
+#if defined(INCLUDE_TEMPLATES) && !defined(TOPOLOGYKERNELT_CC)
+#include "TopologyKernelT.cc"
+#endif
+
 #endif /* TOPOLOGYKERNEL_HH_ */
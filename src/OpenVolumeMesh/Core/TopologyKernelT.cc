@@ -0,0 +1,135 @@
+/*===========================================================================*\
+ *                                                                           *
+ *                            OpenVolumeMesh                                 *
+ *        Copyright (C) 2011 by Computer Graphics Group, RWTH Aachen         *
+ *                        www.openvolumemesh.org                             *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ *  This file is part of OpenVolumeMesh.                                     *
+ *                                                                           *
+ *  OpenVolumeMesh is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU Lesser General Public License as           *
+ *  published by the Free Software Foundation, either version 3 of           *
+ *  the License, or (at your option) any later version with the              *
+ *  following exceptions:                                                    *
+ *                                                                           *
+ *  If other files instantiate templates or use macros                       *
+ *  or inline functions from this file, or you compile this file and         *
+ *  link it with other files to produce an executable, this file does        *
+ *  not by itself cause the resulting executable to be covered by the        *
+ *  GNU Lesser General Public License. This exception does not however       *
+ *  invalidate any other reasons why the executable file might be            *
+ *  covered by the GNU Lesser General Public License.                        *
+ *                                                                           *
+ *  OpenVolumeMesh is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of           *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            *
+ *  GNU Lesser General Public License for more details.                      *
+ *                                                                           *
+ *  You should have received a copy of the GNU LesserGeneral Public          *
+ *  License along with OpenVolumeMesh.  If not,                              *
+ *  see <http://www.gnu.org/licenses/>.                                      *
+ *                                                                           *
+\*===========================================================================*/
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                    *
+ *   $LastChangedBy$                                                *
+ *                                                                           *
+\*===========================================================================*/
+
+#define TOPOLOGYKERNELT_CC
+
+#include <algorithm>
+#include <vector>
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+#include "TopologyKernel.hh"
+
+namespace OpenVolumeMesh {
+
+namespace detail {
+
+// Calls _f for the handles with indices in [_begin, _end)
+template <class HandleT, class FuncT>
+void for_each_in_chunk(const EntityRange<HandleT>& _range, const FuncT& _f, int _begin, int _end) {
+
+    if(_range.contiguous()) {
+        for(int i = _begin; i < _end; ++i) _f(HandleT(i));
+    } else {
+        for(typename EntityRange<HandleT>::iterator it = _range.from(_begin); it->idx() < _end; ++it) {
+            _f(*it);
+        }
+    }
+}
+
+// Partial result of one chunk, wrapped to keep std::vector<bool> out
+template <class ValueT>
+struct ChunkResult {
+    explicit ChunkResult(const ValueT& _value) : value(_value) {}
+    ValueT value;
+};
+
+} // Namespace detail
+
+template <class HandleT, class FuncT>
+void TopologyKernel::parallel_for(const EntityRange<HandleT>& _range, const FuncT& _f, int _chunk_size) const {
+
+    const int n = _range.end_index();
+    const int chunk_size = std::max(_chunk_size, 1);
+    const int n_chunks = (n + chunk_size - 1) / chunk_size;
+
+#ifdef USE_OPENMP
+    const int n_threads = std::min(effective_num_threads(), n_chunks);
+    if(n_threads > 1) {
+        #pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1)
+        for(int c = 0; c < n_chunks; ++c) {
+            detail::for_each_in_chunk(_range, _f, c * chunk_size, std::min(n, (c + 1) * chunk_size));
+        }
+        return;
+    }
+#endif
+
+    detail::for_each_in_chunk(_range, _f, 0, n);
+}
+
+template <class HandleT, class ValueT, class MapT, class ReduceT>
+ValueT TopologyKernel::parallel_reduce(const EntityRange<HandleT>& _range, const ValueT& _identity,
+                                       const MapT& _map, const ReduceT& _reduce, int _chunk_size) const {
+
+    const int n = _range.end_index();
+    const int chunk_size = std::max(_chunk_size, 1);
+    const int n_chunks = (n + chunk_size - 1) / chunk_size;
+
+    std::vector<detail::ChunkResult<ValueT> > results(n_chunks, detail::ChunkResult<ValueT>(_identity));
+
+#ifdef USE_OPENMP
+    const int n_threads = std::max(std::min(effective_num_threads(), n_chunks), 1);
+    #pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1) if(n_threads > 1)
+#endif
+    for(int c = 0; c < n_chunks; ++c) {
+        const int end = std::min(n, (c + 1) * chunk_size);
+        ValueT value = _identity;
+        if(_range.contiguous()) {
+            for(int i = c * chunk_size; i < end; ++i) value = _reduce(value, _map(HandleT(i)));
+        } else {
+            for(typename EntityRange<HandleT>::iterator it = _range.from(c * chunk_size); it->idx() < end; ++it) {
+                value = _reduce(value, _map(*it));
+            }
+        }
+        results[c].value = value;
+    }
+
+    ValueT result = _identity;
+    for(int c = 0; c < n_chunks; ++c) {
+        result = _reduce(result, results[c].value);
+    }
+    return result;
+}
+
+} // Namespace OpenVolumeMesh
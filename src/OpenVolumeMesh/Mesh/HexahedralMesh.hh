@@ -45,6 +45,7 @@
 
 #include "HexahedralMeshTopologyKernel.hh"
 #include "../Core/GeometryKernel.hh"
+#include "../Core/StaticKernel.hh"
 
 namespace OpenVolumeMesh {
 
@@ -72,6 +73,12 @@ typedef GeometryKernel<Geometry::Vec4uc, HexahedralMeshTopologyKernel> Geometric
 
 typedef HexahedralMeshTopologyKernel TopologicHexahedralMesh;
 
+/*
+ * Variants with statically bound accessors (see StaticKernel)
+ */
+typedef StaticKernel<GeometricHexahedralMeshV3f> StaticHexahedralMeshV3f;
+typedef StaticKernel<GeometricHexahedralMeshV3d> StaticHexahedralMeshV3d;
+
 } // Namespace OpenVolumeMesh
 
 #endif /* HEXAHEDRALMESH_HH_ */
@@ -237,48 +237,18 @@ BaseIter(_mesh, _ref_h, _max_laps) {
     assert(_ref_h.is_valid());
     assert(_mesh->cell(_ref_h).halffaces().size() == 6);
 
-    // Get first half-face
-    HalfFaceHandle curHF = *_mesh->cell(_ref_h).halffaces().begin();
-    assert(curHF.is_valid());
-
-    // Get first half-edge
-    assert(_mesh->halfface(curHF).halfedges().size() == 4);
-    HalfEdgeHandle curHE = *_mesh->halfface(curHF).halfedges().begin();
-    assert(curHE.is_valid());
-
-    vertices_.push_back(_mesh->halfedge(curHE).from_vertex());
-
-    curHE = _mesh->prev_halfedge_in_halfface(curHE, curHF);
-
-    vertices_.push_back(_mesh->halfedge(curHE).from_vertex());
-
-    curHE = _mesh->prev_halfedge_in_halfface(curHE, curHF);
-
-    vertices_.push_back(_mesh->halfedge(curHE).from_vertex());
-
-    curHE = _mesh->prev_halfedge_in_halfface(curHE, curHF);
-
-    vertices_.push_back(_mesh->halfedge(curHE).from_vertex());
-
-    curHE = _mesh->prev_halfedge_in_halfface(curHE, curHF);
-    curHF = _mesh->adjacent_halfface_in_cell(curHF, curHE);
-    curHE = _mesh->opposite_halfedge_handle(curHE);
-    curHE = _mesh->next_halfedge_in_halfface(curHE, curHF);
-    curHE = _mesh->next_halfedge_in_halfface(curHE, curHF);
-    curHF = _mesh->adjacent_halfface_in_cell(curHF, curHE);
-    curHE = _mesh->opposite_halfedge_handle(curHE);
-
-    vertices_.push_back(_mesh->halfedge(curHE).to_vertex());
-
-    curHE = _mesh->prev_halfedge_in_halfface(curHE, curHF);
-
-    vertices_.push_back(_mesh->halfedge(curHE).to_vertex());
-
-    curHE = _mesh->prev_halfedge_in_halfface(curHE, curHF);
-
-    vertices_.push_back(_mesh->halfedge(curHE).to_vertex());
-
-    vertices_.push_back(_mesh->halfedge(curHE).from_vertex());
+    // Read the vertices from the table if the mesh maintains it
+    if(_mesh->has_cell_vertex_table()) {
+        for(unsigned int i = 0; i < 8; ++i) {
+            vertices_.push_back(_mesh->cell_vertex(_ref_h, i));
+        }
+    } else {
+        int vs[8];
+        _mesh->compute_cell_vertices(_ref_h, vs);
+        for(unsigned int i = 0; i < 8; ++i) {
+            vertices_.push_back(VertexHandle(vs[i]));
+        }
+    }
 
     cur_index_ = 0;
     BaseIter::valid(vertices_.size() > 0);
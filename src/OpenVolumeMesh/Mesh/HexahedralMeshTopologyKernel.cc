@@ -47,6 +47,9 @@ namespace OpenVolumeMesh {
 
 HexahedralMeshTopologyKernel::HexahedralMeshTopologyKernel() {
 
+    // Hexahedra always have six half-faces and eight vertices
+    set_fixed_cell_valence(6u);
+    n_vertices_per_cell_ = 8u;
 }
 
 //========================================================================================
@@ -186,6 +189,52 @@ HexahedralMeshTopologyKernel::add_cell(const std::vector<HalfFaceHandle>& _halff
 
 //========================================================================================
 
+void HexahedralMeshTopologyKernel::compute_cell_vertices(const CellHandle& _ch, int* _vertices) const {
+
+    assert(_ch.is_valid());
+    assert(cell(_ch).halffaces().size() == 6);
+
+    // Get first half-face
+    HalfFaceHandle curHF = *cell(_ch).halffaces().begin();
+    assert(curHF.is_valid());
+
+    // Walk along the corners of the half-faces, which
+    // does not search for the current half-edge
+    assert(valence(face_handle(curHF)) == 4);
+    HalfFaceCorner c(curHF, 0u);
+    HalfEdgeHandle curHE = corner_halfedge(c);
+
+    _vertices[0] = halfedge(curHE).from_vertex().idx();
+
+    c = prev_corner(c);
+    _vertices[1] = halfedge(corner_halfedge(c)).from_vertex().idx();
+
+    c = prev_corner(c);
+    _vertices[2] = halfedge(corner_halfedge(c)).from_vertex().idx();
+
+    c = prev_corner(c);
+    _vertices[3] = halfedge(corner_halfedge(c)).from_vertex().idx();
+
+    curHF = adjacent_halfface_in_cell(curHF, curHE);
+    c = next_corner(next_corner(corner(opposite_halfedge_handle(curHE), curHF)));
+    curHE = corner_halfedge(c);
+    curHF = adjacent_halfface_in_cell(curHF, curHE);
+    c = corner(opposite_halfedge_handle(curHE), curHF);
+    curHE = corner_halfedge(c);
+
+    _vertices[4] = halfedge(curHE).to_vertex().idx();
+
+    c = prev_corner(c);
+    _vertices[5] = halfedge(corner_halfedge(c)).to_vertex().idx();
+
+    c = prev_corner(c);
+    curHE = corner_halfedge(c);
+    _vertices[6] = halfedge(curHE).to_vertex().idx();
+    _vertices[7] = halfedge(curHE).from_vertex().idx();
+}
+
+//========================================================================================
+
 bool HexahedralMeshTopologyKernel::check_halfface_ordering(const std::vector<HalfFaceHandle>& _hfs) const {
 
     /*
@@ -426,7 +475,7 @@ HexahedralMeshTopologyKernel::add_cell(const std::vector<VertexHandle>& _vertice
                 end = hfs.end(); it != end; ++it) {
 
             OpenVolumeMeshFace hface = halfface(*it);
-            for(std::vector<HalfEdgeHandle>::const_iterator he_it = hface.halfedges().begin(),
+            for(Face::HalfEdgeView::const_iterator he_it = hface.halfedges().begin(),
                     he_end = hface.halfedges().end(); he_it != he_end; ++he_it) {
                 incidentHalfedges.insert(*he_it);
                 incidentEdges.insert(edge_handle(*he_it));
@@ -462,6 +511,37 @@ HexahedralMeshTopologyKernel::add_cell(const std::vector<VertexHandle>& _vertice
 
 //========================================================================================
 
+CellHandle HexahedralMeshTopologyKernel::add_cells(const int* _cellVertices, size_t _nCells) {
+
+    // Local vertex indices of the half-faces XF, XB, YF, YB, ZF, ZB
+    static const int cellFaces[6][4] = {
+        {3, 2, 1, 0}, {7, 6, 5, 4}, {1, 2, 6, 7},
+        {4, 5, 3, 0}, {1, 7, 4, 0}, {2, 3, 5, 6}
+    };
+
+    std::vector<int> faceVertices(_nCells * 24);
+    std::vector<size_t> faceOffsets(_nCells * 6 + 1);
+    std::vector<size_t> cellFaceOffsets(_nCells + 1);
+
+    for(size_t c = 0; c < _nCells; ++c) {
+        const int* cv = _cellVertices + c * 8;
+        for(int f = 0; f < 6; ++f) {
+            for(int k = 0; k < 4; ++k) {
+                faceVertices[c * 24 + f * 4 + k] = cv[cellFaces[f][k]];
+            }
+            faceOffsets[c * 6 + f] = c * 24 + f * 4;
+        }
+        cellFaceOffsets[c] = c * 6;
+    }
+    faceOffsets[_nCells * 6] = _nCells * 24;
+    cellFaceOffsets[_nCells] = _nCells * 6;
+
+    return TopologyKernel::add_cells(faceVertices.empty() ? 0 : &faceVertices[0],
+                                     &faceOffsets[0], &cellFaceOffsets[0], _nCells);
+}
+
+//========================================================================================
+
 const HalfFaceHandle&
 HexahedralMeshTopologyKernel::get_adjacent_halfface(const HalfFaceHandle& _hfh, const HalfEdgeHandle& _heh,
         const std::vector<HalfFaceHandle>& _halffaces) const {
@@ -114,6 +114,11 @@ public:
     /// Overridden function
     virtual CellHandle add_cell(const std::vector<HalfFaceHandle>& _halffaces, bool _topologyCheck = false);
 
+protected:
+
+    // Overridden function, the vertices in the order of HexVertexIter
+    virtual void compute_cell_vertices(const CellHandle& _ch, int* _vertices) const;
+
 private:
 
     bool check_halfface_ordering(const std::vector<HalfFaceHandle>& _hfs) const;
@@ -142,6 +147,22 @@ public:
      */
     CellHandle add_cell(const std::vector<VertexHandle>& _vertices, bool _topologyCheck = false);
 
+    /**
+     * \brief Add _nCells hexahedra at once
+     *
+     * @param _cellVertices Eight vertex indices per cell, in the order
+     *                      expected by add_cell(const std::vector<VertexHandle>&)
+     * @param _nCells Number of cells
+     *
+     * The result is the same as adding the cells one after another.
+     *
+     * @return The first new hexahedron's cell handle
+     */
+    CellHandle add_cells(const int* _cellVertices, size_t _nCells);
+
+    // Keep the polyhedral add_cells() overload visible
+    using TopologyKernel::add_cells;
+
     // ======================= Specialized Iterators =============================
 
     friend class CellSheetCellIter;
@@ -186,7 +207,7 @@ public:
 
     inline HalfFaceHandle opposite_halfface_handle_in_cell(const HalfFaceHandle& _hfh, const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
         if(orientation(_hfh, _ch) == XF) return xback_halfface(_ch);
         if(orientation(_hfh, _ch) == XB) return xfront_halfface(_ch);
@@ -200,53 +221,53 @@ public:
 
     inline HalfFaceHandle xfront_halfface(const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        return TopologyKernel::cell(_ch).halffaces()[XF];
+        return TopologyKernel::cell_halffaces_[6u * _ch.idx() + XF];
     }
 
     inline HalfFaceHandle xback_halfface(const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        return TopologyKernel::cell(_ch).halffaces()[XB];
+        return TopologyKernel::cell_halffaces_[6u * _ch.idx() + XB];
     }
 
     inline HalfFaceHandle yfront_halfface(const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        return TopologyKernel::cell(_ch).halffaces()[YF];
+        return TopologyKernel::cell_halffaces_[6u * _ch.idx() + YF];
     }
 
     inline HalfFaceHandle yback_halfface(const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        return TopologyKernel::cell(_ch).halffaces()[YB];
+        return TopologyKernel::cell_halffaces_[6u * _ch.idx() + YB];
     }
 
     inline HalfFaceHandle zfront_halfface(const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        return TopologyKernel::cell(_ch).halffaces()[ZF];
+        return TopologyKernel::cell_halffaces_[6u * _ch.idx() + ZF];
     }
 
     inline HalfFaceHandle zback_halfface(const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        return TopologyKernel::cell(_ch).halffaces()[ZB];
+        return TopologyKernel::cell_halffaces_[6u * _ch.idx() + ZB];
     }
 
     unsigned char orientation(const HalfFaceHandle& _hfh, const CellHandle& _ch) const {
 
-        assert((unsigned int)_ch.idx() < TopologyKernel::cells_.size());
+        assert((unsigned int)_ch.idx() < TopologyKernel::n_cells());
 
-        std::vector<HalfFaceHandle> halffaces = TopologyKernel::cell(_ch).halffaces();
-        for(unsigned int i = 0; i < halffaces.size(); ++i) {
-            if(halffaces[i] == _hfh) return (unsigned char)i;
+        const HalfFaceHandle* halffaces = &TopologyKernel::cell_halffaces_[6u * _ch.idx()];
+        for(unsigned char i = 0; i < 6u; ++i) {
+            if(halffaces[i] == _hfh) return i;
         }
 
         return INVALID;
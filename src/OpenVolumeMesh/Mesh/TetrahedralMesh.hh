@@ -45,6 +45,7 @@
 
 #include "TetrahedralMeshTopologyKernel.hh"
 #include "../Core/GeometryKernel.hh"
+#include "../Core/StaticKernel.hh"
 
 namespace OpenVolumeMesh {
 
@@ -72,6 +73,12 @@ typedef GeometryKernel<Geometry::Vec4uc, TetrahedralMeshTopologyKernel> Geometri
 
 typedef TetrahedralMeshTopologyKernel TopologicTetrahedralMesh;
 
+/*
+ * Variants with statically bound accessors (see StaticKernel)
+ */
+typedef StaticKernel<GeometricTetrahedralMeshV3f> StaticTetrahedralMeshV3f;
+typedef StaticKernel<GeometricTetrahedralMeshV3d> StaticTetrahedralMeshV3d;
+
 } // Namespace OpenVolumeMesh
 
 #endif /* TETRAHEDRALMESH_HH_ */
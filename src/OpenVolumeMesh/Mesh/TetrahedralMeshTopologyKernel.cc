@@ -42,6 +42,7 @@
 
 #include "TetrahedralMeshTopologyKernel.hh"
 
+#include <algorithm>
 #include <iostream>
 
 namespace OpenVolumeMesh {
@@ -49,6 +50,9 @@ namespace OpenVolumeMesh {
 
 TetrahedralMeshTopologyKernel::TetrahedralMeshTopologyKernel() {
 
+    // Tetrahedra always have four half-faces and four vertices
+    set_fixed_cell_valence(4u);
+    n_vertices_per_cell_ = 4u;
 }
 
 //========================================================================================
@@ -262,12 +266,12 @@ void TetrahedralMeshTopologyKernel::collapse_edge(HalfEdgeHandle _heh)
                         incidentHfs.push_back(cur_hf);
                 }
 
-                std::swap(incident_hfs_per_he_[target], incidentHfs);
+                incident_hfs_per_he_[target] = incidentHfs;
             }
 
-            std::vector<HalfFaceHandle>& vec = incident_hfs_per_he_[he21];
+            IncidenceArray<HalfFaceHandle>::Row vec = incident_hfs_per_he_[he21];
             vec.erase(std::remove(vec.begin(), vec.end(), hf132), vec.end());
-            std::vector<HalfFaceHandle>& vec2 = incident_hfs_per_he_[he12];
+            IncidenceArray<HalfFaceHandle>::Row vec2 = incident_hfs_per_he_[he12];
             vec2.erase(std::remove(vec2.begin(), vec2.end(), hf123), vec2.end());
 
         }
@@ -285,13 +289,13 @@ void TetrahedralMeshTopologyKernel::collapse_edge(HalfEdgeHandle _heh)
         Edge he = halfedge(*voh_it);
         if (he.to_vertex() == to_vh)
         {
-            std::vector<HalfEdgeHandle>& vec = outgoing_hes_per_vertex_[to_vh];
+            IncidenceArray<HalfEdgeHandle>::Row vec = outgoing_hes_per_vertex_[to_vh];
             vec.erase(std::remove(vec.begin(), vec.end(), opposite_halfedge_handle(*voh_it)), vec.end());
         }
         EdgeHandle eh = edge_handle(*voh_it);
         if (!deleteTagEdges[eh.idx()])
         {
-            std::vector<HalfEdgeHandle>& vec = outgoing_hes_per_vertex_[to_vh];
+            IncidenceArray<HalfEdgeHandle>::Row vec = outgoing_hes_per_vertex_[to_vh];
             vec.push_back(opposite_halfedge_handle(*voh_it));
 
             Edge& e = edges_[eh.idx()];
@@ -352,8 +356,18 @@ VertexHandle TetrahedralMeshTopologyKernel::collapse_edge(HalfEdgeHandle _heh)
     }
 
     std::vector<CellHandle> incidentCells;
-    for (VertexCellIter vc_it = vc_iter(from_vh); vc_it.valid(); ++vc_it)
-        incidentCells.push_back(*vc_it);
+    if (has_vertex_cell_incidences())
+    {
+        // Copy, the incidences change while the cells are replaced below
+        ConstArrayView<CellHandle> cells = incident_cells(from_vh);
+        incidentCells.assign(cells.begin(), cells.end());
+        std::sort(incidentCells.begin(), incidentCells.end());
+    }
+    else
+    {
+        for (VertexCellIter vc_it = vc_iter(from_vh); vc_it.valid(); ++vc_it)
+            incidentCells.push_back(*vc_it);
+    }
 
     for (unsigned int i = 0; i < incidentCells.size(); ++i)
     {
@@ -480,6 +494,35 @@ void TetrahedralMeshTopologyKernel::split_face(FaceHandle _fh, VertexHandle _vh)
 }
 
 
+void TetrahedralMeshTopologyKernel::compute_cell_vertices(const CellHandle& _ch, int* _vertices) const {
+
+    assert(_ch.is_valid());
+    assert(cell(_ch).halffaces().size() == 4);
+
+    // Get first half-face
+    HalfFaceHandle curHF = *cell(_ch).halffaces().begin();
+    assert(curHF.is_valid());
+
+    // Walk along the corners of the half-faces, which
+    // does not search for the current half-edge
+    assert(valence(face_handle(curHF)) == 3);
+    HalfFaceCorner c(curHF, 0u);
+
+    _vertices[0] = halfedge(corner_halfedge(c)).to_vertex().idx();
+
+    c = next_corner(c);
+    _vertices[1] = halfedge(corner_halfedge(c)).to_vertex().idx();
+
+    c = next_corner(c);
+    const HalfEdgeHandle curHE = corner_halfedge(c);
+    _vertices[2] = halfedge(curHE).to_vertex().idx();
+
+    curHF = adjacent_halfface_in_cell(curHF, curHE);
+    c = next_corner(corner(opposite_halfedge_handle(curHE), curHF));
+
+    _vertices[3] = halfedge(corner_halfedge(c)).to_vertex().idx();
+}
+
 std::vector<VertexHandle> TetrahedralMeshTopologyKernel::get_cell_vertices(CellHandle ch) const
 {
     return get_cell_vertices(cell(ch).halffaces().front());
@@ -668,7 +711,7 @@ TetrahedralMeshTopologyKernel::add_cell(const std::vector<VertexHandle>& _vertic
                 end = hfs.end(); it != end; ++it) {
 
             OpenVolumeMeshFace hface = halfface(*it);
-            for(std::vector<HalfEdgeHandle>::const_iterator he_it = hface.halfedges().begin(),
+            for(Face::HalfEdgeView::const_iterator he_it = hface.halfedges().begin(),
                     he_end = hface.halfedges().end(); he_it != he_end; ++he_it) {
                 incidentHalfedges.insert(*he_it);
                 incidentEdges.insert(edge_handle(*he_it));
@@ -714,4 +757,32 @@ CellHandle TetrahedralMeshTopologyKernel::add_cell(VertexHandle _vh0, VertexHand
 
 //========================================================================================
 
+CellHandle TetrahedralMeshTopologyKernel::add_cells(const int* _cellVertices, size_t _nCells)
+{
+    // Local vertex indices of the faces, same as in add_cell()
+    static const int cellFaces[4][3] = { {0, 1, 2}, {0, 2, 3}, {0, 3, 1}, {1, 3, 2} };
+
+    std::vector<int> faceVertices(_nCells * 12);
+    std::vector<size_t> faceOffsets(_nCells * 4 + 1);
+    std::vector<size_t> cellFaceOffsets(_nCells + 1);
+
+    for(size_t c = 0; c < _nCells; ++c) {
+        const int* cv = _cellVertices + c * 4;
+        for(int f = 0; f < 4; ++f) {
+            for(int k = 0; k < 3; ++k) {
+                faceVertices[c * 12 + f * 3 + k] = cv[cellFaces[f][k]];
+            }
+            faceOffsets[c * 4 + f] = c * 12 + f * 3;
+        }
+        cellFaceOffsets[c] = c * 4;
+    }
+    faceOffsets[_nCells * 4] = _nCells * 12;
+    cellFaceOffsets[_nCells] = _nCells * 4;
+
+    return TopologyKernel::add_cells(faceVertices.empty() ? 0 : &faceVertices[0],
+                                     &faceOffsets[0], &cellFaceOffsets[0], _nCells);
+}
+
+//========================================================================================
+
 } // Namespace OpenVolumeMesh
@@ -81,6 +81,18 @@ public:
     CellHandle add_cell(const std::vector<VertexHandle>& _vertices, bool _topologyCheck = false);
     CellHandle add_cell(VertexHandle _vh0, VertexHandle _vh1, VertexHandle _vh2, VertexHandle _vh3, bool _topologyCheck = false);
 
+    /// \brief Add _nCells tetrahedra at once
+    ///
+    /// _cellVertices holds four vertex indices per cell, in the order
+    /// expected by add_cell(const std::vector<VertexHandle>&). The result
+    /// is the same as adding the cells one after another.
+    ///
+    /// \return Handle of the first new cell
+    CellHandle add_cells(const int* _cellVertices, size_t _nCells);
+
+    // Keep the polyhedral add_cells() overload visible
+    using TopologyKernel::add_cells;
+
     HalfFaceHandle add_halfface(const std::vector<HalfEdgeHandle>& _halfedges, bool _topologyCheck = false);
     HalfFaceHandle add_halfface(VertexHandle _vh0, VertexHandle _vh1, VertexHandle _vh2, bool _topologyCheck = false);
 
@@ -101,6 +113,9 @@ protected:
     void split_edge(HalfEdgeHandle _heh, VertexHandle _vh);
     void split_face(FaceHandle _fh, VertexHandle _vh);
 
+    // Overridden function, the vertices in the order of TetVertexIter
+    virtual void compute_cell_vertices(const CellHandle& _ch, int* _vertices) const;
+
 public:
 
 
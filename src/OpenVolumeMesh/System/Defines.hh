@@ -63,4 +63,13 @@
     #endif
 #endif
 
+// Prevents further overriding of virtual functions if supported
+#ifndef OVM_FINAL
+    #if __cplusplus >= 201103L
+        #define OVM_FINAL final
+    #else
+        #define OVM_FINAL
+    #endif
+#endif
+
 #endif /* DEFINES_HH_ */
@@ -1,3 +1,5 @@
+#include <set>
+
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
 
@@ -1184,6 +1186,331 @@ TEST_F(PolyhedralMeshBase, DeleteLastFaceTestNoBU) {
     }
 }
 
+TEST_F(PolyhedralMeshBase, FaceHalfEdgeStorage) {
+
+    generatePolyhedralMesh(mesh_);
+
+    mesh_.enable_fast_deletion(true);
+
+    const size_t n_faces = mesh_.n_faces();
+    std::vector<HalfEdgeHandle> hes0 = mesh_.face(FaceHandle(1)).halfedges();
+    std::vector<HalfEdgeHandle> hesLast = mesh_.face(FaceHandle((int)n_faces - 1)).halfedges();
+
+    // Fast deletion moves the last face into the deleted face's slot
+    mesh_.delete_face(FaceHandle(0));
+
+    EXPECT_EQ(n_faces - 1, mesh_.n_faces());
+
+    std::vector<HalfEdgeHandle> hes = mesh_.face(FaceHandle(0)).halfedges();
+    EXPECT_EQ(hesLast, hes);
+
+    // Changing a face's valence must not affect other faces
+    std::vector<HalfEdgeHandle> tri(hes0.begin(), hes0.begin() + 3);
+    for(int i = 0; i < 10; ++i) {
+        mesh_.set_face(FaceHandle(1), (i % 2 == 0) ? tri : hes0);
+    }
+    mesh_.set_face(FaceHandle(1), tri);
+
+    EXPECT_EQ(3u, mesh_.valence(FaceHandle(1)));
+    hes = mesh_.face(FaceHandle(1)).halfedges();
+    EXPECT_EQ(tri, hes);
+    hes = mesh_.face(FaceHandle(0)).halfedges();
+    EXPECT_EQ(hesLast, hes);
+}
+
+TEST_F(PolyhedralMeshBase, IncrementalBottomUpIncidences) {
+
+    generatePolyhedralMesh(mesh_);
+
+    // Grow the incidence lists of a single vertex beyond their capacity
+    for(int i = 0; i < 20; ++i) {
+        VertexHandle vh = mesh_.add_vertex(Vec3d(i, -1.0, 0.0));
+        mesh_.add_edge(VertexHandle(0), vh);
+    }
+    mesh_.delete_edge(EdgeHandle(3));
+
+    std::vector<std::set<HalfEdgeHandle> > outgoing(mesh_.n_vertices());
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+        for(VertexOHalfEdgeIter voh_it = mesh_.voh_iter(*v_it); voh_it.valid(); ++voh_it) {
+            outgoing[v_it->idx()].insert(*voh_it);
+        }
+    }
+
+    // Rebuilding from scratch must yield the same incidences
+    mesh_.enable_vertex_bottom_up_incidences(false);
+    mesh_.enable_vertex_bottom_up_incidences(true);
+
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+        std::set<HalfEdgeHandle> hes;
+        for(VertexOHalfEdgeIter voh_it = mesh_.voh_iter(*v_it); voh_it.valid(); ++voh_it) {
+            hes.insert(*voh_it);
+        }
+        EXPECT_EQ(outgoing[v_it->idx()], hes);
+    }
+
+    EXPECT_EQ(outgoing[0].size(), mesh_.valence(VertexHandle(0)));
+}
+
+TEST_F(PolyhedralMeshBase, EdgeIndex) {
+
+    mesh_.enable_bottom_up_incidences(false);
+    mesh_.enable_edge_index();
+
+    std::vector<VertexHandle> vs;
+    for(int i = 0; i < 100; ++i) {
+        vs.push_back(mesh_.add_vertex(Vec3d(i, 0.0, 0.0)));
+    }
+    for(int i = 0; i < 99; ++i) {
+        EXPECT_EQ(EdgeHandle(i), mesh_.add_edge(vs[i], vs[i + 1]));
+    }
+
+    // Duplicates are found in both directions
+    EXPECT_EQ(EdgeHandle(5), mesh_.add_edge(vs[5], vs[6]));
+    EXPECT_EQ(EdgeHandle(5), mesh_.add_edge(vs[6], vs[5]));
+    EXPECT_EQ(99u, mesh_.n_edges());
+
+    EXPECT_EQ(HalfEdgeHandle(10), mesh_.halfedge(vs[5], vs[6]));
+    EXPECT_EQ(HalfEdgeHandle(11), mesh_.halfedge(vs[6], vs[5]));
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfEdgeHandle, mesh_.halfedge(vs[5], vs[7]));
+
+    // Deferred deleted edges are not found anymore
+    mesh_.enable_deferred_deletion(true);
+    mesh_.delete_edge(EdgeHandle(98));
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfEdgeHandle, mesh_.halfedge(vs[98], vs[99]));
+    EXPECT_EQ(EdgeHandle(99), mesh_.add_edge(vs[98], vs[99]));
+    EXPECT_EQ(HalfEdgeHandle(198), mesh_.halfedge(vs[98], vs[99]));
+    mesh_.collect_garbage();
+    EXPECT_EQ(99u, mesh_.n_edges());
+    EXPECT_EQ(HalfEdgeHandle(196), mesh_.halfedge(vs[98], vs[99]));
+
+    // Edge handles shift after deleting an edge
+    mesh_.enable_deferred_deletion(false);
+    mesh_.enable_fast_deletion(false);
+    mesh_.delete_edge(EdgeHandle(0));
+
+    EXPECT_EQ(HalfEdgeHandle(8), mesh_.halfedge(vs[5], vs[6]));
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfEdgeHandle, mesh_.halfedge(vs[0], vs[1]));
+
+    // The last edge is moved to the deleted edge's position
+    mesh_.enable_fast_deletion(true);
+    mesh_.delete_edge(EdgeHandle(0));
+
+    EXPECT_EQ(HalfEdgeHandle(1), mesh_.halfedge(vs[99], vs[98]));
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfEdgeHandle, mesh_.halfedge(vs[1], vs[2]));
+
+    mesh_.set_edge(EdgeHandle(0), vs[0], vs[50]);
+    EXPECT_EQ(EdgeHandle(0), mesh_.add_edge(vs[50], vs[0]));
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfEdgeHandle, mesh_.halfedge(vs[99], vs[98]));
+}
+
+TEST_F(PolyhedralMeshBase, FaceIndex) {
+
+    mesh_.enable_bottom_up_incidences(false);
+    mesh_.enable_face_index();
+
+    // 10x10 quad grid
+    const int n = 11;
+    for(int i = 0; i < n; ++i) {
+        for(int j = 0; j < n; ++j) {
+            mesh_.add_vertex(Vec3d(i, j, 0.0));
+        }
+    }
+    for(int i = 0; i < n - 1; ++i) {
+        for(int j = 0; j < n - 1; ++j) {
+            std::vector<VertexHandle> vs;
+            vs.push_back(VertexHandle(i * n + j));
+            vs.push_back(VertexHandle(i * n + j + 1));
+            vs.push_back(VertexHandle((i + 1) * n + j + 1));
+            vs.push_back(VertexHandle((i + 1) * n + j));
+            mesh_.add_face(vs);
+        }
+    }
+    EXPECT_EQ(100u, mesh_.n_faces());
+
+    std::vector<VertexHandle> vs;
+    vs.push_back(VertexHandle(1 * n + 2));
+    vs.push_back(VertexHandle(2 * n + 2));
+    vs.push_back(VertexHandle(2 * n + 1));
+    vs.push_back(VertexHandle(1 * n + 1));
+
+    // Any starting vertex, both orientations
+    EXPECT_EQ(HalfFaceHandle(2 * 11), mesh_.halfface(vs));
+    EXPECT_EQ(HalfFaceHandle(2 * 11), mesh_.halfface_extensive(vs));
+    std::reverse(vs.begin(), vs.end());
+    EXPECT_EQ(HalfFaceHandle(2 * 11 + 1), mesh_.halfface(vs));
+    EXPECT_EQ(HalfFaceHandle(2 * 11 + 1), mesh_.halfface_extensive(vs));
+
+    // Same vertex set, but not in connected order
+    std::swap(vs[0], vs[1]);
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfFaceHandle, mesh_.halfface_extensive(vs));
+    std::swap(vs[0], vs[1]);
+
+    // Face handles shift after deleting a face
+    mesh_.enable_deferred_deletion(false);
+    mesh_.enable_fast_deletion(false);
+    mesh_.delete_face(FaceHandle(0));
+    EXPECT_EQ(HalfFaceHandle(2 * 10 + 1), mesh_.halfface_extensive(vs));
+
+    // The last face is moved to the deleted face's position
+    mesh_.enable_fast_deletion(true);
+    mesh_.delete_face(FaceHandle(0));
+
+    std::vector<VertexHandle> last;
+    last.push_back(VertexHandle(9 * n + 9));
+    last.push_back(VertexHandle(9 * n + 10));
+    last.push_back(VertexHandle(10 * n + 10));
+    last.push_back(VertexHandle(10 * n + 9));
+    EXPECT_EQ(HalfFaceHandle(0), mesh_.halfface_extensive(last));
+    EXPECT_EQ(HalfFaceHandle(2 * 10 + 1), mesh_.halfface_extensive(vs));
+
+    std::vector<VertexHandle> deleted;
+    deleted.push_back(VertexHandle(1));
+    deleted.push_back(VertexHandle(2));
+    deleted.push_back(VertexHandle(n + 2));
+    deleted.push_back(VertexHandle(n + 1));
+    EXPECT_EQ(PolyhedralMesh::InvalidHalfFaceHandle, mesh_.halfface_extensive(deleted));
+}
+
+TEST_F(PolyhedralMeshBase, ReserveEntities) {
+
+    VertexPropertyT<int> v_prop = mesh_.request_vertex_property<int>("ReserveVProp");
+    EdgePropertyT<int> e_prop = mesh_.request_edge_property<int>("ReserveEProp");
+
+    mesh_.reserve(100, 200, 0, 0);
+
+    const VertexHandle v0 = mesh_.add_vertex(Vec3d(0.0, 0.0, 0.0));
+    const VertexHandle v1 = mesh_.add_vertex(Vec3d(1.0, 0.0, 0.0));
+    const EdgeHandle e0 = mesh_.add_edge(v0, v1);
+
+    const Vec3d* p0 = &mesh_.vertex(v0);
+    const int* vp0 = &v_prop[v0];
+    const int* ep0 = &e_prop[e0];
+
+    for(int i = 2; i < 100; ++i) {
+        mesh_.add_vertex(Vec3d((double)i, 0.0, 0.0));
+        mesh_.add_edge(VertexHandle(i - 1), VertexHandle(i));
+    }
+
+    // Nothing has been reallocated
+    EXPECT_EQ(p0, &mesh_.vertex(v0));
+    EXPECT_EQ(vp0, &v_prop[v0]);
+    EXPECT_EQ(ep0, &e_prop[e0]);
+
+    EXPECT_EQ(100u, mesh_.n_vertices());
+    EXPECT_EQ(99u, mesh_.n_edges());
+}
+
+// Functors for the parallel loops below
+class StoreTwiceIndex {
+public:
+    explicit StoreTwiceIndex(VertexPropertyT<int>& _prop) : prop_(_prop) {}
+    void operator()(const VertexHandle& _vh) const { prop_[_vh] = 2 * _vh.idx(); }
+private:
+    VertexPropertyT<int>& prop_;
+};
+
+struct VertexIndex {
+    long operator()(const VertexHandle& _vh) const { return _vh.idx(); }
+};
+
+struct Sum {
+    long operator()(long _a, long _b) const { return _a + _b; }
+};
+
+TEST_F(PolyhedralMeshBase, ParallelForAndReduce) {
+
+    mesh_.enable_deferred_deletion(true);
+
+    const int n = 20000;
+    for(int i = 0; i < n; ++i) {
+        mesh_.add_vertex(Vec3d(i, 0.0, 0.0));
+    }
+    long expected_sum = 0;
+    for(int i = 0; i < n; ++i) {
+        if(i % 7 == 3) {
+            mesh_.delete_vertex(VertexHandle(i));
+        } else {
+            expected_sum += i;
+        }
+    }
+
+    VertexPropertyT<int> prop = mesh_.request_vertex_property<int>("ParallelProp", -1);
+
+    const unsigned int n_threads[2] = { 1u, 4u };
+    for(int k = 0; k < 2; ++k) {
+
+        mesh_.set_num_threads(n_threads[k]);
+
+        mesh_.parallel_for_vertices(StoreTwiceIndex(prop), 100);
+        for(int i = 0; i < n; ++i) {
+            EXPECT_EQ(i % 7 == 3 ? -1 : 2 * i, prop[VertexHandle(i)]);
+        }
+
+        EXPECT_EQ(expected_sum, mesh_.parallel_reduce(mesh_.vertex_range(), 0l, VertexIndex(), Sum(), 100));
+    }
+
+    // Empty range
+    mesh_.clear();
+    EXPECT_EQ(0l, mesh_.parallel_reduce(mesh_.vertex_range(), 0l, VertexIndex(), Sum()));
+}
+
+TEST_F(PolyhedralMeshBase, ParallelBottomUpIncidences) {
+
+    // Quad grid, large enough for the incidences to be computed in parallel
+    const int n = 150;
+    for(int i = 0; i < n; ++i) {
+        for(int j = 0; j < n; ++j) {
+            mesh_.add_vertex(Vec3d(i, j, 0.0));
+        }
+    }
+    for(int i = 0; i < n - 1; ++i) {
+        for(int j = 0; j < n - 1; ++j) {
+            std::vector<VertexHandle> vs;
+            vs.push_back(VertexHandle(i * n + j));
+            vs.push_back(VertexHandle(i * n + j + 1));
+            vs.push_back(VertexHandle((i + 1) * n + j + 1));
+            vs.push_back(VertexHandle((i + 1) * n + j));
+            FaceHandle fh = mesh_.add_face(vs);
+
+            std::vector<HalfFaceHandle> hfs;
+            hfs.push_back(mesh_.halfface_handle(fh, (i + j) % 2));
+            mesh_.add_cell(hfs);
+        }
+    }
+
+    std::vector<std::vector<HalfEdgeHandle> > outgoing[2];
+    std::vector<std::vector<HalfFaceHandle> > incident[2];
+    std::vector<CellHandle> cells[2];
+
+    const unsigned int n_threads[2] = { 1u, 4u };
+    for(int k = 0; k < 2; ++k) {
+
+        mesh_.set_num_threads(n_threads[k]);
+        mesh_.enable_bottom_up_incidences(false);
+        mesh_.enable_bottom_up_incidences(true);
+
+        for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+            outgoing[k].push_back(std::vector<HalfEdgeHandle>());
+            for(VertexOHalfEdgeIter voh_it = mesh_.voh_iter(*v_it); voh_it.valid(); ++voh_it) {
+                outgoing[k].back().push_back(*voh_it);
+            }
+        }
+        for(HalfEdgeIter he_it = mesh_.halfedges_begin(); he_it != mesh_.halfedges_end(); ++he_it) {
+            incident[k].push_back(std::vector<HalfFaceHandle>());
+            for(HalfEdgeHalfFaceIter hehf_it = mesh_.hehf_iter(*he_it); hehf_it.valid(); ++hehf_it) {
+                incident[k].back().push_back(*hehf_it);
+            }
+        }
+        for(HalfFaceIter hf_it = mesh_.halffaces_begin(); hf_it != mesh_.halffaces_end(); ++hf_it) {
+            cells[k].push_back(mesh_.incident_cell(*hf_it));
+        }
+    }
+
+    EXPECT_EQ(outgoing[0], outgoing[1]);
+    EXPECT_EQ(incident[0], incident[1]);
+    EXPECT_EQ(cells[0], cells[1]);
+}
+
 /*
  * Hexahedral mesh tests
  */
@@ -1615,6 +1942,64 @@ TEST_F(HexahedralMeshBase, GarbageCollectionTestTrackCellHandles) {
     EXPECT_EQ(8u, mesh_.n_vertices());
 }
 
+TEST_F(HexahedralMeshBase, GarbageCollectionRemap) {
+
+    generateHexahedralMesh(mesh_);
+
+    VertexPropertyT<int> vprop = mesh_.request_vertex_property<int>("index");
+    HalfEdgePropertyT<int> heprop = mesh_.request_halfedge_property<int>("index");
+    HalfFacePropertyT<int> hfprop = mesh_.request_halfface_property<int>("index");
+    CellPropertyT<int> cprop = mesh_.request_cell_property<int>("index");
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) vprop[*v_it] = v_it->idx();
+    for(HalfEdgeIter he_it = mesh_.halfedges_begin(); he_it != mesh_.halfedges_end(); ++he_it) heprop[*he_it] = he_it->idx();
+    for(HalfFaceIter hf_it = mesh_.halffaces_begin(); hf_it != mesh_.halffaces_end(); ++hf_it) hfprop[*hf_it] = hf_it->idx();
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) cprop[*c_it] = c_it->idx();
+
+    StatusAttrib status(mesh_);
+    status[VertexHandle(0)].set_deleted(true);
+
+    HandleRemap remap;
+    status.garbage_collection(remap, true);
+
+    EXPECT_EQ(12u, remap.vertices.size());
+    EXPECT_EQ(-1, remap.vertices[0]);
+    EXPECT_EQ(-1, remap.cells[0]);
+    EXPECT_EQ(0, remap.cells[1]);
+    EXPECT_EQ(8u, mesh_.n_vertices());
+    for(int i = 0; i < (int)remap.vertices.size(); ++i) {
+        if(remap.vertices[i] >= 0) {
+            EXPECT_EQ(i, vprop[VertexHandle(remap.vertices[i])]);
+        }
+    }
+    for(int i = 0; i < 2 * (int)remap.edges.size(); ++i) {
+        const HalfEdgeHandle he = remap[HalfEdgeHandle(i)];
+        if(he.is_valid()) {
+            EXPECT_EQ(i, heprop[he]);
+        }
+    }
+    for(int i = 0; i < 2 * (int)remap.faces.size(); ++i) {
+        const HalfFaceHandle hf = remap[HalfFaceHandle(i)];
+        if(hf.is_valid()) {
+            EXPECT_EQ(i, hfprop[hf]);
+        }
+    }
+    EXPECT_EQ(mesh_.n_faces(), (size_t)(remap.faces.size() -
+              std::count(remap.faces.begin(), remap.faces.end(), -1)));
+    EXPECT_EQ(TopologyKernel::InvalidVertexHandle, remap[TopologyKernel::InvalidVertexHandle]);
+
+    // Same for the deferred deletion of the kernel
+    mesh_.enable_deferred_deletion(true);
+    mesh_.delete_face(FaceHandle(1));
+    mesh_.collect_garbage(remap);
+    EXPECT_EQ(0u, mesh_.n_cells());
+    EXPECT_EQ(-1, remap.faces[1]);
+    EXPECT_EQ(1, remap.faces[2]);
+    EXPECT_EQ(-1, remap.cells[0]);
+    for(int i = 0; i < (int)remap.vertices.size(); ++i) {
+        EXPECT_EQ(i, remap.vertices[i]);
+    }
+}
+
 TEST_F(HexahedralMeshBase, GarbageCollectionTestProps1) {
 
     generateHexahedralMesh(mesh_);
@@ -1843,6 +2228,308 @@ TEST_F(HexahedralMeshBase, HalfFaceFetchFunction2) {
     EXPECT_EQ(HexahedralMesh::InvalidHalfFaceHandle, hfInv1);
 }
 
+TEST_F(HexahedralMeshBase, HalfFaceCorners) {
+
+    generateHexahedralMesh(mesh_);
+
+    for(HalfFaceIter hf_it = mesh_.halffaces_begin(); hf_it != mesh_.halffaces_end(); ++hf_it) {
+
+        // Odd halffaces are built from the face's halfedges
+        const std::vector<HalfEdgeHandle> hes = mesh_.halfface(*hf_it).halfedges();
+        const std::vector<HalfEdgeHandle> opp = mesh_.opposite_halfface(*hf_it).halfedges();
+        ASSERT_EQ(4u, hes.size());
+        ASSERT_EQ(hes.size(), opp.size());
+
+        for(unsigned int i = 0; i < hes.size(); ++i) {
+            const HalfFaceCorner c(*hf_it, i);
+            EXPECT_EQ(hes[i], mesh_.corner_halfedge(c));
+            EXPECT_EQ(c, mesh_.corner(hes[i], *hf_it));
+            EXPECT_EQ(hes[(i + 1) % 4], mesh_.corner_halfedge(mesh_.next_corner(c)));
+            EXPECT_EQ(hes[(i + 3) % 4], mesh_.corner_halfedge(mesh_.prev_corner(c)));
+            EXPECT_EQ(hes[(i + 1) % 4], mesh_.next_halfedge_in_halfface(hes[i], *hf_it));
+            EXPECT_EQ(hes[(i + 3) % 4], mesh_.prev_halfedge_in_halfface(hes[i], *hf_it));
+
+            const HalfFaceCorner o = mesh_.opposite_corner(c);
+            EXPECT_EQ(mesh_.opposite_halfface_handle(*hf_it), o.halfface());
+            EXPECT_EQ(mesh_.opposite_halfedge_handle(hes[i]), mesh_.corner_halfedge(o));
+            EXPECT_EQ(mesh_.opposite_halfedge_handle(hes[i]), opp[hes.size() - 1 - i]);
+            EXPECT_EQ(c, mesh_.opposite_corner(o));
+        }
+
+        // Halfedges of the opposite halfface are not part of this one
+        EXPECT_FALSE(mesh_.corner(opp[0], *hf_it).is_valid());
+        EXPECT_EQ(HexahedralMesh::InvalidHalfEdgeHandle, mesh_.next_halfedge_in_halfface(opp[0], *hf_it));
+    }
+}
+
+TEST_F(HexahedralMeshBase, FixedArityCellStorage) {
+
+    generateHexahedralMesh(mesh_);
+
+    mesh_.enable_fast_deletion(true);
+
+    std::vector<HalfFaceHandle> hfs1 = mesh_.cell(CellHandle(1)).halffaces();
+    EXPECT_EQ(6u, hfs1.size());
+    EXPECT_EQ(6u, mesh_.valence(CellHandle(1)));
+
+    // Fast deletion moves the last cell into the deleted cell's slot
+    mesh_.delete_cell(CellHandle(0));
+
+    EXPECT_EQ(1u, mesh_.n_cells());
+
+    std::vector<HalfFaceHandle> hfs0 = mesh_.cell(CellHandle(0)).halffaces();
+    EXPECT_EQ(hfs1, hfs0);
+
+    EXPECT_EQ(hfs1[HexahedralMesh::XF], mesh_.xfront_halfface(CellHandle(0)));
+    EXPECT_EQ(hfs1[HexahedralMesh::XB], mesh_.xback_halfface(CellHandle(0)));
+    EXPECT_EQ(hfs1[HexahedralMesh::YF], mesh_.yfront_halfface(CellHandle(0)));
+    EXPECT_EQ(hfs1[HexahedralMesh::YB], mesh_.yback_halfface(CellHandle(0)));
+    EXPECT_EQ(hfs1[HexahedralMesh::ZF], mesh_.zfront_halfface(CellHandle(0)));
+    EXPECT_EQ(hfs1[HexahedralMesh::ZB], mesh_.zback_halfface(CellHandle(0)));
+
+    for(unsigned char i = 0; i < 6; ++i) {
+        EXPECT_EQ(i, mesh_.orientation(hfs1[i], CellHandle(0)));
+    }
+    EXPECT_EQ(CellHandle(0), mesh_.incident_cell(hfs1[0]));
+}
+
+TEST_F(HexahedralMeshBase, ParallelHalfFaceReordering) {
+
+    // Hexahedral grid with enough edges to be reordered in parallel
+    const int n = 13;
+    for(int k = 0; k < n; ++k) {
+        for(int j = 0; j < n; ++j) {
+            for(int i = 0; i < n; ++i) {
+                mesh_.add_vertex(Vec3d(i, j, k));
+            }
+        }
+    }
+    for(int k = 0; k < n - 1; ++k) {
+        for(int j = 0; j < n - 1; ++j) {
+            for(int i = 0; i < n - 1; ++i) {
+                const int v = (k * n + j) * n + i;
+                std::vector<VertexHandle> vs;
+                vs.push_back(VertexHandle(v));
+                vs.push_back(VertexHandle(v + 1));
+                vs.push_back(VertexHandle(v + n + 1));
+                vs.push_back(VertexHandle(v + n));
+                vs.push_back(VertexHandle(v + n * n));
+                vs.push_back(VertexHandle(v + n * n + n));
+                vs.push_back(VertexHandle(v + n * n + n + 1));
+                vs.push_back(VertexHandle(v + n * n + 1));
+                EXPECT_NE(HexahedralMesh::InvalidCellHandle, mesh_.add_cell(vs));
+            }
+        }
+    }
+
+    // Incremental construction keeps the halffaces ordered
+    std::vector<std::vector<HalfFaceHandle> > ordered;
+    for(HalfEdgeIter he_it = mesh_.halfedges_begin(); he_it != mesh_.halfedges_end(); ++he_it) {
+        ordered.push_back(std::vector<HalfFaceHandle>());
+        for(HalfEdgeHalfFaceIter hehf_it = mesh_.hehf_iter(*he_it); hehf_it.valid(); ++hehf_it) {
+            ordered.back().push_back(*hehf_it);
+        }
+    }
+
+    mesh_.set_num_threads(4u);
+    mesh_.enable_face_bottom_up_incidences(false);
+    mesh_.enable_face_bottom_up_incidences(true);
+
+    size_t i = 0;
+    for(HalfEdgeIter he_it = mesh_.halfedges_begin(); he_it != mesh_.halfedges_end(); ++he_it, ++i) {
+        std::vector<HalfFaceHandle> hfs;
+        for(HalfEdgeHalfFaceIter hehf_it = mesh_.hehf_iter(*he_it); hehf_it.valid(); ++hehf_it) {
+            hfs.push_back(*hehf_it);
+        }
+        EXPECT_EQ(ordered[i], hfs);
+    }
+}
+
+template <class MeshT>
+void expectSameTopology(const MeshT& _a, const MeshT& _b) {
+
+    ASSERT_EQ(_a.n_vertices(), _b.n_vertices());
+    ASSERT_EQ(_a.n_edges(), _b.n_edges());
+    ASSERT_EQ(_a.n_faces(), _b.n_faces());
+    ASSERT_EQ(_a.n_cells(), _b.n_cells());
+
+    for(EdgeIter e_it = _a.edges_begin(); e_it != _a.edges_end(); ++e_it) {
+        EXPECT_EQ(_a.edge(*e_it).from_vertex(), _b.edge(*e_it).from_vertex());
+        EXPECT_EQ(_a.edge(*e_it).to_vertex(), _b.edge(*e_it).to_vertex());
+    }
+    for(FaceIter f_it = _a.faces_begin(); f_it != _a.faces_end(); ++f_it) {
+        EXPECT_EQ(std::vector<HalfEdgeHandle>(_a.face(*f_it).halfedges()),
+                  std::vector<HalfEdgeHandle>(_b.face(*f_it).halfedges()));
+    }
+    for(CellIter c_it = _a.cells_begin(); c_it != _a.cells_end(); ++c_it) {
+        EXPECT_EQ(std::vector<HalfFaceHandle>(_a.cell(*c_it).halffaces()),
+                  std::vector<HalfFaceHandle>(_b.cell(*c_it).halffaces()));
+    }
+    for(HalfFaceIter hf_it = _a.halffaces_begin(); hf_it != _a.halffaces_end(); ++hf_it) {
+        EXPECT_EQ(_a.incident_cell(*hf_it), _b.incident_cell(*hf_it));
+    }
+    for(HalfEdgeIter he_it = _a.halfedges_begin(); he_it != _a.halfedges_end(); ++he_it) {
+        std::vector<HalfFaceHandle> hfsA, hfsB;
+        for(HalfEdgeHalfFaceIter hehf_it = _a.hehf_iter(*he_it); hehf_it.valid(); ++hehf_it) {
+            hfsA.push_back(*hehf_it);
+        }
+        for(HalfEdgeHalfFaceIter hehf_it = _b.hehf_iter(*he_it); hehf_it.valid(); ++hehf_it) {
+            hfsB.push_back(*hehf_it);
+        }
+        // Same cyclic order, but possibly another first halfface
+        if(!hfsA.empty()) {
+            std::vector<HalfFaceHandle>::iterator first = std::find(hfsB.begin(), hfsB.end(), hfsA[0]);
+            if(first != hfsB.end()) std::rotate(hfsB.begin(), first, hfsB.end());
+        }
+        EXPECT_EQ(hfsA, hfsB);
+    }
+}
+
+TEST_F(HexahedralMeshBase, BulkCellConstruction) {
+
+    const int n = 5;
+    std::vector<double> coords;
+    for(int k = 0; k < n; ++k) {
+        for(int j = 0; j < n; ++j) {
+            for(int i = 0; i < n; ++i) {
+                coords.push_back(i);
+                coords.push_back(j);
+                coords.push_back(k);
+            }
+        }
+    }
+    std::vector<int> cellVertices;
+    for(int k = 0; k < n - 1; ++k) {
+        for(int j = 0; j < n - 1; ++j) {
+            for(int i = 0; i < n - 1; ++i) {
+                const int v = (k * n + j) * n + i;
+                const int cv[8] = { v, v + 1, v + n + 1, v + n,
+                                    v + n * n, v + n * n + n, v + n * n + n + 1, v + n * n + 1 };
+                cellVertices.insert(cellVertices.end(), cv, cv + 8);
+            }
+        }
+    }
+    const size_t nCells = cellVertices.size() / 8;
+
+    // Cells added one after another
+    HexahedralMesh reference;
+    for(size_t i = 0; i < coords.size(); i += 3) {
+        reference.add_vertex(Vec3d(coords[i], coords[i + 1], coords[i + 2]));
+    }
+    for(size_t c = 0; c < nCells; ++c) {
+        std::vector<VertexHandle> vs;
+        for(int k = 0; k < 8; ++k) {
+            vs.push_back(VertexHandle(cellVertices[c * 8 + k]));
+        }
+        reference.add_cell(vs);
+    }
+
+    EXPECT_EQ(VertexHandle(0), mesh_.add_vertices(&coords[0], coords.size() / 3));
+    EXPECT_EQ(Vec3d(1.0, 2.0, 3.0), mesh_.vertex(VertexHandle((3 * n + 2) * n + 1)));
+
+    // Split into two batches, the second one shares faces with the first
+    const size_t half = nCells / 2;
+    EXPECT_EQ(CellHandle(0), mesh_.add_cells(&cellVertices[0], half));
+    EXPECT_EQ(CellHandle((int)half), mesh_.add_cells(&cellVertices[half * 8], nCells - half));
+
+    expectSameTopology(reference, mesh_);
+
+    // Without bottom-up incidences, computed afterwards
+    HexahedralMesh mesh;
+    mesh.enable_bottom_up_incidences(false);
+    mesh.add_vertices(&coords[0], coords.size() / 3);
+    EXPECT_EQ(CellHandle(0), mesh.add_cells(&cellVertices[0], nCells));
+    mesh.enable_bottom_up_incidences(true);
+
+    expectSameTopology(reference, mesh);
+}
+
+TEST_F(TetrahedralMeshBase, BulkCellConstruction) {
+
+    // Cubes split into six tetrahedra around their diagonal, the first
+    // three paths along the axes are even permutations, the others odd
+    const int n = 4;
+    std::vector<double> coords;
+    for(int k = 0; k < n; ++k) {
+        for(int j = 0; j < n; ++j) {
+            for(int i = 0; i < n; ++i) {
+                coords.push_back(i);
+                coords.push_back(j);
+                coords.push_back(k);
+            }
+        }
+    }
+    std::vector<int> cellVertices;
+    for(int k = 0; k < n - 1; ++k) {
+        for(int j = 0; j < n - 1; ++j) {
+            for(int i = 0; i < n - 1; ++i) {
+                const int v = (k * n + j) * n + i;
+                const int dx = 1, dy = n, dz = n * n;
+                const int path[6][2] = { {dx, dy}, {dy, dz}, {dz, dx}, {dy, dx}, {dz, dy}, {dx, dz} };
+                for(int t = 0; t < 6; ++t) {
+                    // Swap two vertices of every other tet to orient all of them alike
+                    const int v1 = v + path[t][0];
+                    const int v2 = v + path[t][0] + path[t][1];
+                    cellVertices.push_back(v);
+                    cellVertices.push_back(t < 3 ? v1 : v2);
+                    cellVertices.push_back(t < 3 ? v2 : v1);
+                    cellVertices.push_back(v + dx + dy + dz);
+                }
+            }
+        }
+    }
+    const size_t nCells = cellVertices.size() / 4;
+
+    TetrahedralMesh reference;
+    for(size_t i = 0; i < coords.size(); i += 3) {
+        reference.add_vertex(Vec3d(coords[i], coords[i + 1], coords[i + 2]));
+    }
+    for(size_t c = 0; c < nCells; ++c) {
+        reference.add_cell(VertexHandle(cellVertices[c * 4]), VertexHandle(cellVertices[c * 4 + 1]),
+                           VertexHandle(cellVertices[c * 4 + 2]), VertexHandle(cellVertices[c * 4 + 3]));
+    }
+
+    mesh_.add_vertices(&coords[0], coords.size() / 3);
+    EXPECT_EQ(CellHandle(0), mesh_.add_cells(&cellVertices[0], nCells));
+
+    expectSameTopology(reference, mesh_);
+
+    // Same cells given by their faces through the polyhedral overload
+    static const int cellFaces[4][3] = { {0, 1, 2}, {0, 2, 3}, {0, 3, 1}, {1, 3, 2} };
+    std::vector<int> faceVertices;
+    std::vector<size_t> faceOffsets, cellFaceOffsets;
+    for(size_t c = 0; c < nCells; ++c) {
+        cellFaceOffsets.push_back(faceOffsets.size());
+        for(int f = 0; f < 4; ++f) {
+            faceOffsets.push_back(faceVertices.size());
+            for(int k = 0; k < 3; ++k) {
+                faceVertices.push_back(cellVertices[c * 4 + cellFaces[f][k]]);
+            }
+        }
+    }
+    faceOffsets.push_back(faceVertices.size());
+    cellFaceOffsets.push_back(nCells * 4);
+
+    TetrahedralMesh faceMesh;
+    faceMesh.add_vertices(&coords[0], coords.size() / 3);
+    EXPECT_EQ(CellHandle(0), faceMesh.add_cells(&faceVertices[0], &faceOffsets[0], &cellFaceOffsets[0], nCells));
+    expectSameTopology(reference, faceMesh);
+
+    // Deleted edges and faces are not reused
+    mesh_.enable_deferred_deletion(true);
+    mesh_.delete_edge(EdgeHandle(0));
+    const CellHandle ch = mesh_.add_cells(&cellVertices[0], 1);
+    EXPECT_EQ(CellHandle((int)nCells), ch);
+    const std::vector<HalfFaceHandle> hfs = mesh_.cell(ch).halffaces();
+    for(std::vector<HalfFaceHandle>::const_iterator hf_it = hfs.begin(); hf_it != hfs.end(); ++hf_it) {
+        EXPECT_FALSE(mesh_.is_deleted(*hf_it));
+        const std::vector<HalfEdgeHandle> hes = mesh_.halfface(*hf_it).halfedges();
+        for(std::vector<HalfEdgeHandle>::const_iterator he_it = hes.begin(); he_it != hes.end(); ++he_it) {
+            EXPECT_FALSE(mesh_.is_deleted(*he_it));
+        }
+    }
+}
+
 TEST_F(HexahedralMeshBase, AddCellViaVerticesFunction1) {
 
     generateHexahedralMesh(mesh_);
@@ -2021,3 +2708,686 @@ TEST_F(PolyhedralMeshBase, DeferredFastDelete) {
 	testDeferredDelete(mesh_);
 }
 
+
+std::vector<int> circulatorCellVertices(const TetrahedralMesh& _mesh, const CellHandle& _ch) {
+    std::vector<int> vs;
+    for(TetVertexIter it = _mesh.tv_iter(_ch); it.valid(); ++it) vs.push_back(it->idx());
+    return vs;
+}
+
+std::vector<int> circulatorCellVertices(const HexahedralMesh& _mesh, const CellHandle& _ch) {
+    std::vector<int> vs;
+    for(HexVertexIter it = _mesh.hv_iter(_ch); it.valid(); ++it) vs.push_back(it->idx());
+    return vs;
+}
+
+// Compare the cell vertex table to the vertices found by walking each cell
+template <class MeshT>
+void expectValidCellVertexTable(MeshT& _mesh) {
+
+    ASSERT_TRUE(_mesh.has_cell_vertex_table());
+    const unsigned int n = _mesh.n_vertices_per_cell();
+    const std::vector<int> table(_mesh.cell_vertex_table(),
+                                 _mesh.cell_vertex_table() + _mesh.n_cells() * n);
+
+    // Without the table, the circulators walk the cells
+    _mesh.enable_cell_vertex_table(false);
+    for(size_t c = 0; c < _mesh.n_cells(); ++c) {
+        if(_mesh.is_deleted(CellHandle((int)c))) continue;
+        EXPECT_EQ(std::vector<int>(table.begin() + c * n, table.begin() + (c + 1) * n),
+                  circulatorCellVertices(_mesh, CellHandle((int)c))) << "cell " << c;
+    }
+    _mesh.enable_cell_vertex_table(true);
+}
+
+// Vertices of the tetrahedra of a grid of n^3 vertices, six per cube
+std::vector<int> tetGridCellVertices(int n) {
+
+    std::vector<int> cellVertices;
+    for(int k = 0; k < n - 1; ++k) {
+        for(int j = 0; j < n - 1; ++j) {
+            for(int i = 0; i < n - 1; ++i) {
+                const int v = (k * n + j) * n + i;
+                const int dx = 1, dy = n, dz = n * n;
+                const int path[6][2] = { {dx, dy}, {dy, dz}, {dz, dx}, {dy, dx}, {dz, dy}, {dx, dz} };
+                for(int t = 0; t < 6; ++t) {
+                    const int v1 = v + path[t][0];
+                    const int v2 = v + path[t][0] + path[t][1];
+                    cellVertices.push_back(v);
+                    cellVertices.push_back(t < 3 ? v1 : v2);
+                    cellVertices.push_back(t < 3 ? v2 : v1);
+                    cellVertices.push_back(v + dx + dy + dz);
+                }
+            }
+        }
+    }
+    return cellVertices;
+}
+
+// Add the vertices and the tetrahedra of a grid of n^3 vertices, six cells
+// one by one and the others in bulk, checking the mesh after each step
+template <class CheckT>
+void addTetGrid(TetrahedralMesh& _mesh, int _n, CheckT _check) {
+
+    for(int i = 0; i < _n * _n * _n; ++i) {
+        _mesh.add_vertex(Vec3d(i % _n, (i / _n) % _n, i / (_n * _n)));
+    }
+
+    const std::vector<int> cellVertices = tetGridCellVertices(_n);
+    for(int c = 0; c < 6; ++c) {
+        _mesh.add_cell(VertexHandle(cellVertices[4 * c]), VertexHandle(cellVertices[4 * c + 1]),
+                       VertexHandle(cellVertices[4 * c + 2]), VertexHandle(cellVertices[4 * c + 3]));
+    }
+    _check(_mesh);
+    _mesh.add_cells(&cellVertices[24], cellVertices.size() / 4 - 6);
+    _check(_mesh);
+}
+
+// Edit a grid built by addTetGrid() in all the ways that renumber or
+// remove entities, checking the mesh after each step
+template <class CheckT>
+void runTetEditScenario(TetrahedralMesh& _mesh, int _n, CheckT _check) {
+
+    // Collapse an interior edge, renumbering the vertices
+    const VertexHandle v0(1 + _n + _n * _n);
+    _mesh.collapse_edge(_mesh.halfedge(v0, VertexHandle(v0.idx() + 1 + _n + _n * _n)));
+    _check(_mesh);
+
+    // Fast deletion swaps the last entity into place
+    _mesh.enable_deferred_deletion(false);
+    _mesh.enable_fast_deletion(true);
+    _mesh.delete_cell(CellHandle(5));
+    _check(_mesh);
+    _mesh.delete_face(FaceHandle(3));
+    _check(_mesh);
+    _mesh.enable_fast_deletion(false);
+    _mesh.delete_cell(CellHandle(7));
+    _check(_mesh);
+    _mesh.delete_edge(EdgeHandle(10));
+    _check(_mesh);
+
+    // Deferred deletion and garbage collection
+    _mesh.enable_deferred_deletion(true);
+    _mesh.delete_vertex(VertexHandle(2));
+    _mesh.delete_cell(CellHandle(10));
+    _check(_mesh);
+    _mesh.collect_garbage();
+    _check(_mesh);
+
+    StatusAttrib status(_mesh);
+    status[VertexHandle(5)].set_deleted(true);
+    status[CellHandle(3)].set_deleted(true);
+    status.garbage_collection(false);
+    _check(_mesh);
+}
+
+TEST_F(TetrahedralMeshBase, CellVertexTable) {
+
+    mesh_.enable_cell_vertex_table();
+    EXPECT_EQ(4u, mesh_.n_vertices_per_cell());
+
+    // Two by two by two cubes, each split into six tetrahedra
+    const int n = 3;
+    addTetGrid(mesh_, n, expectValidCellVertexTable<TetrahedralMesh>);
+    EXPECT_EQ(48u, mesh_.n_cells());
+
+    // The cell vertices are the ones passed to add_cell() up to rotation
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    std::vector<int> vs(mesh_.cell_vertex_table() + 4, mesh_.cell_vertex_table() + 8);
+    std::vector<int> expected(cellVertices.begin() + 4, cellVertices.begin() + 8);
+    std::sort(vs.begin(), vs.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, vs);
+
+    runTetEditScenario(mesh_, n, expectValidCellVertexTable<TetrahedralMesh>);
+    for(size_t i = 0; i < mesh_.n_cells() * 4u; ++i) {
+        EXPECT_LT(mesh_.cell_vertex_table()[i], (int)mesh_.n_vertices());
+    }
+}
+
+TEST_F(HexahedralMeshBase, CellVertexTable) {
+
+    generateHexahedralMesh(mesh_);
+
+    mesh_.enable_cell_vertex_table();
+    EXPECT_EQ(8u, mesh_.n_vertices_per_cell());
+    expectValidCellVertexTable(mesh_);
+
+    // Same order as the circulator
+    std::vector<int> vs;
+    for(HexVertexIter it = mesh_.hv_iter(CellHandle(1)); it.valid(); ++it) vs.push_back(it->idx());
+    for(unsigned int i = 0; i < 8; ++i) {
+        EXPECT_EQ(VertexHandle(vs[i]), mesh_.cell_vertex(CellHandle(1), i));
+    }
+
+    // Deleting a vertex removes the first cell and renumbers the others
+    StatusAttrib status(mesh_);
+    status[VertexHandle(0)].set_deleted(true);
+    status.garbage_collection(false);
+    EXPECT_EQ(1u, mesh_.n_cells());
+    expectValidCellVertexTable(mesh_);
+
+    // Polyhedral meshes have no fixed number of vertices per cell
+    PolyhedralMesh polyMesh;
+    EXPECT_EQ(0u, polyMesh.n_vertices_per_cell());
+}
+
+// Compare the vertex-cell incidences to the cells found via the bottom-up incidences
+template <class MeshT>
+void expectValidVertexCellIncidences(MeshT& _mesh) {
+
+    ASSERT_TRUE(_mesh.has_vertex_cell_incidences());
+    std::vector<std::vector<CellHandle> > cells(_mesh.n_vertices());
+    for(size_t v = 0; v < _mesh.n_vertices(); ++v) {
+        for(VertexCellIter it = _mesh.vc_iter(VertexHandle((int)v)); it.valid(); ++it) {
+            cells[v].push_back(*it);
+        }
+        EXPECT_EQ(cells[v].size(), _mesh.incident_cells(VertexHandle((int)v)).size());
+    }
+
+    _mesh.enable_vertex_cell_incidences(false);
+    for(size_t v = 0; v < _mesh.n_vertices(); ++v) {
+        std::vector<CellHandle> expected;
+        for(VertexCellIter it = _mesh.vc_iter(VertexHandle((int)v)); it.valid(); ++it) {
+            expected.push_back(*it);
+        }
+        EXPECT_EQ(expected, cells[v]) << "vertex " << v;
+    }
+    _mesh.enable_vertex_cell_incidences(true);
+}
+
+TEST_F(TetrahedralMeshBase, VertexCellIncidences) {
+
+    mesh_.enable_vertex_cell_incidences();
+
+    const int n = 4;
+    addTetGrid(mesh_, n, expectValidVertexCellIncidences<TetrahedralMesh>);
+
+    // The center vertex of the first cube is shared by its six tetrahedra
+    EXPECT_EQ(6u, mesh_.incident_cells(VertexHandle(0)).size());
+
+    runTetEditScenario(mesh_, n, expectValidVertexCellIncidences<TetrahedralMesh>);
+
+    // Works without the bottom-up incidences
+    mesh_.enable_bottom_up_incidences(false);
+    EXPECT_TRUE(mesh_.vc_iter(VertexHandle(1)).valid());
+}
+
+// Compare the boundary index to the boundary found via the bottom-up incidences
+template <class MeshT>
+void expectValidBoundaryIndex(MeshT& _mesh) {
+
+    ASSERT_TRUE(_mesh.has_boundary_index());
+    std::set<FaceHandle> faces;
+    for(BoundaryFaceIter it = _mesh.bf_iter(); it.valid(); ++it) {
+        EXPECT_TRUE(faces.insert(*it).second);
+    }
+    EXPECT_EQ(faces.size(), _mesh.boundary_faces().size());
+
+    std::vector<bool> vertices, edges;
+    for(size_t v = 0; v < _mesh.n_vertices(); ++v) vertices.push_back(_mesh.is_boundary(VertexHandle((int)v)));
+    for(size_t e = 0; e < _mesh.n_edges(); ++e) edges.push_back(_mesh.is_boundary(EdgeHandle((int)e)));
+
+    _mesh.enable_boundary_index(false);
+    std::set<FaceHandle> expectedFaces;
+    for(BoundaryFaceIter it = _mesh.bf_iter(); it.valid(); ++it) {
+        expectedFaces.insert(*it);
+    }
+    EXPECT_EQ(expectedFaces, faces);
+    for(size_t v = 0; v < _mesh.n_vertices(); ++v) {
+        EXPECT_EQ(_mesh.is_boundary(VertexHandle((int)v)), vertices[v]) << "vertex " << v;
+    }
+    for(size_t e = 0; e < _mesh.n_edges(); ++e) {
+        EXPECT_EQ(_mesh.is_boundary(EdgeHandle((int)e)), edges[e]) << "edge " << e;
+        EXPECT_EQ(_mesh.is_boundary(_mesh.halfedge_handle(EdgeHandle((int)e), 1)), edges[e]) << "edge " << e;
+    }
+    _mesh.enable_boundary_index(true);
+}
+
+TEST_F(TetrahedralMeshBase, BoundaryIndex) {
+
+    mesh_.enable_boundary_index();
+
+    const int n = 4;
+    addTetGrid(mesh_, n, expectValidBoundaryIndex<TetrahedralMesh>);
+
+    // Only the faces of the grid's sides are on the boundary
+    EXPECT_EQ(6u * 2u * (n - 1) * (n - 1), mesh_.boundary_faces().size());
+    EXPECT_FALSE(mesh_.is_boundary(VertexHandle(1 + n + n * n)));
+    EXPECT_TRUE(mesh_.is_boundary(VertexHandle(1)));
+
+    runTetEditScenario(mesh_, n, expectValidBoundaryIndex<TetrahedralMesh>);
+}
+
+// Compare the halfface adjacency table to adjacent_halfface_in_cell() without it
+template <class MeshT>
+void expectValidHalfFaceAdjacency(MeshT& _mesh) {
+
+    ASSERT_TRUE(_mesh.has_cell_halfface_adjacency());
+    std::vector<HalfFaceHandle> adjacent;
+    for(CellIter c_it = _mesh.cells_begin(); c_it != _mesh.cells_end(); ++c_it) {
+        const std::vector<HalfFaceHandle> hfs = _mesh.cell(*c_it).halffaces();
+        for(size_t i = 0; i < hfs.size(); ++i) {
+            const std::vector<HalfEdgeHandle> hes = _mesh.halfface(hfs[i]).halfedges();
+            for(size_t j = 0; j < hes.size(); ++j) {
+                adjacent.push_back(_mesh.adjacent_halfface_in_cell(hfs[i], hes[j]));
+                EXPECT_TRUE(adjacent.back().is_valid());
+            }
+        }
+    }
+
+    _mesh.enable_cell_halfface_adjacency(false);
+    size_t n = 0;
+    for(CellIter c_it = _mesh.cells_begin(); c_it != _mesh.cells_end(); ++c_it) {
+        const std::vector<HalfFaceHandle> hfs = _mesh.cell(*c_it).halffaces();
+        for(size_t i = 0; i < hfs.size(); ++i) {
+            const std::vector<HalfEdgeHandle> hes = _mesh.halfface(hfs[i]).halfedges();
+            for(size_t j = 0; j < hes.size(); ++j, ++n) {
+                ASSERT_LT(n, adjacent.size());
+                EXPECT_EQ(_mesh.adjacent_halfface_in_cell(hfs[i], hes[j]), adjacent[n]);
+            }
+        }
+    }
+    EXPECT_EQ(adjacent.size(), n);
+    _mesh.enable_cell_halfface_adjacency(true);
+}
+
+TEST_F(TetrahedralMeshBase, CellHalfFaceAdjacency) {
+
+    mesh_.enable_cell_halfface_adjacency();
+
+    const int n = 3;
+    addTetGrid(mesh_, n, expectValidHalfFaceAdjacency<TetrahedralMesh>);
+
+    // Adjacency is symmetric
+    const HalfFaceHandle hf = mesh_.cell(CellHandle(0)).halffaces()[0];
+    const HalfEdgeHandle he = mesh_.halfface(hf).halfedges()[0];
+    EXPECT_EQ(hf, mesh_.adjacent_halfface_in_cell(mesh_.adjacent_halfface_in_cell(hf, he), he));
+
+    runTetEditScenario(mesh_, n, expectValidHalfFaceAdjacency<TetrahedralMesh>);
+}
+
+// Compare the cell neighbor table to the cells found via the face bottom-up incidences
+template <class MeshT>
+void expectValidCellNeighborTable(const MeshT& _mesh) {
+
+    ASSERT_TRUE(_mesh.has_cell_neighbor_table());
+    const unsigned int n = _mesh.n_halffaces_per_cell();
+    for(CellIter c_it = _mesh.cells_begin(); c_it != _mesh.cells_end(); ++c_it) {
+        const std::vector<HalfFaceHandle> hfs = _mesh.cell(*c_it).halffaces();
+        ASSERT_EQ(n, hfs.size());
+        for(unsigned int i = 0; i < n; ++i) {
+            const CellHandle expected = _mesh.incident_cell(_mesh.opposite_halfface_handle(hfs[i]));
+            EXPECT_EQ(expected, _mesh.cell_neighbor(*c_it, i)) << "cell " << c_it->idx();
+            EXPECT_EQ(expected.idx(), _mesh.cell_neighbor_table()[c_it->idx() * n + i]);
+        }
+    }
+}
+
+TEST_F(TetrahedralMeshBase, CellNeighborTable) {
+
+    mesh_.enable_cell_neighbor_table();
+
+    const int n = 4;
+    addTetGrid(mesh_, n, expectValidCellNeighborTable<TetrahedralMesh>);
+
+    // Same neighbors as CellCellIter
+    std::vector<CellHandle> viaTable;
+    for(CellCellIter it = mesh_.cc_iter(CellHandle(10)); it.valid(); ++it) viaTable.push_back(*it);
+    mesh_.enable_cell_neighbor_table(false);
+    std::vector<CellHandle> viaIncidences;
+    for(CellCellIter it = mesh_.cc_iter(CellHandle(10)); it.valid(); ++it) viaIncidences.push_back(*it);
+    EXPECT_EQ(viaIncidences, viaTable);
+    mesh_.enable_cell_neighbor_table(true);
+
+    runTetEditScenario(mesh_, n, expectValidCellNeighborTable<TetrahedralMesh>);
+
+    // Polyhedral meshes have no fixed number of halffaces per cell
+    PolyhedralMesh polyMesh;
+    polyMesh.enable_cell_neighbor_table();
+    EXPECT_FALSE(polyMesh.has_cell_neighbor_table());
+}
+
+// Look up each face by its vertices, halfface_extensive() only searches the index
+template <class MeshT>
+void expectValidFaceIndex(MeshT& _mesh) {
+
+    ASSERT_TRUE(_mesh.has_face_index());
+    for(FaceIter f_it = _mesh.faces_begin(); f_it != _mesh.faces_end(); ++f_it) {
+        std::vector<VertexHandle> vs;
+        for(HalfFaceVertexIter hfv_it = _mesh.hfv_iter(_mesh.halfface_handle(*f_it, 0)); hfv_it.valid(); ++hfv_it) {
+            vs.push_back(*hfv_it);
+        }
+        EXPECT_EQ(_mesh.halfface_handle(*f_it, 0), _mesh.halfface_extensive(vs));
+    }
+}
+
+TEST_F(TetrahedralMeshBase, FaceIndexFastDeletion) {
+
+    const int n = 4;
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+
+    mesh_.enable_face_index();
+    expectValidFaceIndex(mesh_);
+
+    // Fast deletion moves the last vertex into the deleted vertex's slot
+    mesh_.enable_deferred_deletion(false);
+    mesh_.enable_fast_deletion(true);
+    mesh_.delete_vertex(VertexHandle(21));
+    expectValidFaceIndex(mesh_);
+    mesh_.delete_vertex(VertexHandle(0));
+    expectValidFaceIndex(mesh_);
+
+    // Same without bottom-up incidences
+    mesh_.enable_bottom_up_incidences(false);
+    mesh_.delete_vertex(VertexHandle(5));
+    expectValidFaceIndex(mesh_);
+}
+
+TEST_F(TetrahedralMeshBase, CellVertexTableFastDeletion) {
+
+    const int n = 4;
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+
+    mesh_.enable_cell_vertex_table();
+    mesh_.enable_vertex_cell_incidences();
+    mesh_.enable_deferred_deletion(false);
+    mesh_.enable_fast_deletion(true);
+
+    // Cells found via the vertex-cell incidences
+    mesh_.delete_vertex(VertexHandle(21));
+    expectValidCellVertexTable(mesh_);
+
+    // Via the bottom-up incidences
+    mesh_.enable_vertex_cell_incidences(false);
+    mesh_.delete_vertex(VertexHandle(0));
+    expectValidCellVertexTable(mesh_);
+
+    // Whole table, the check needs the incidences again
+    mesh_.enable_bottom_up_incidences(false);
+    mesh_.delete_vertex(VertexHandle(5));
+    mesh_.enable_bottom_up_incidences(true);
+    expectValidCellVertexTable(mesh_);
+}
+
+TEST_F(TetrahedralMeshBase, DeleteTagged) {
+
+    const int n = 4;
+    TetrahedralMesh reference;
+    reference.enable_deferred_deletion(false);
+    reference.enable_fast_deletion(false);
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+        reference.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+    reference.add_cells(&cellVertices[0], cellVertices.size() / 4);
+
+    mesh_.enable_boundary_index();
+    mesh_.enable_vertex_cell_incidences();
+    mesh_.enable_cell_vertex_table();
+    mesh_.enable_cell_neighbor_table();
+    VertexPropertyT<int> vprop = mesh_.request_vertex_property<int>("index");
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+        vprop[*v_it] = v_it->idx();
+    }
+
+    // Same result as deleting one entity after the other without reordering
+    reference.delete_cell(CellHandle(3));
+    reference.delete_edge(EdgeHandle(0));
+    reference.delete_vertex(VertexHandle(21));
+
+    std::vector<bool> vertexTags(mesh_.n_vertices(), false);
+    std::vector<bool> edgeTags(mesh_.n_edges(), false);
+    std::vector<bool> cellTags(mesh_.n_cells(), false);
+    vertexTags[21] = true;
+    edgeTags[0] = true;
+    cellTags[3] = true;
+    mesh_.delete_tagged(vertexTags, edgeTags, std::vector<bool>(), cellTags);
+
+    // The direction of the halfface cycles around boundary edges is arbitrary
+    reference.enable_edge_bottom_up_incidences(false);
+    reference.enable_edge_bottom_up_incidences(true);
+    expectSameTopology(mesh_, reference);
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+        EXPECT_EQ(v_it->idx() < 21 ? v_it->idx() : v_it->idx() + 1, vprop[*v_it]);
+        EXPECT_EQ(reference.vertex(*v_it), mesh_.vertex(*v_it));
+    }
+    expectValidBoundaryIndex(mesh_);
+    expectValidVertexCellIncidences(mesh_);
+    expectValidCellVertexTable(mesh_);
+    expectValidCellNeighborTable(mesh_);
+
+    // Entities marked as deleted are collected in the same pass
+    mesh_.enable_deferred_deletion(true);
+    const size_t nCells = mesh_.n_cells();
+    mesh_.delete_cell(CellHandle(0));
+    cellTags.assign(mesh_.n_cells(), false);
+    cellTags[1] = true;
+    mesh_.delete_tagged(std::vector<bool>(), std::vector<bool>(), std::vector<bool>(), cellTags);
+    EXPECT_EQ(nCells - 2, mesh_.n_cells());
+    EXPECT_FALSE(mesh_.needs_garbage_collection());
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) {
+        EXPECT_FALSE(mesh_.is_deleted(*c_it));
+    }
+    expectValidBoundaryIndex(mesh_);
+    expectValidCellNeighborTable(mesh_);
+}
+
+TEST_F(TetrahedralMeshBase, ParallelCompaction) {
+
+    // Large enough for the compaction loops to run in parallel
+    const int n = 17;
+    TetrahedralMesh serial;
+    serial.set_num_threads(1);
+    mesh_.set_num_threads(4);
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+        serial.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+    serial.add_cells(&cellVertices[0], cellVertices.size() / 4);
+    mesh_.enable_cell_vertex_table();
+    serial.enable_cell_vertex_table();
+
+    HalfFacePropertyT<int> hfpropA = mesh_.request_halfface_property<int>("index");
+    HalfFacePropertyT<int> hfpropB = serial.request_halfface_property<int>("index");
+    CellPropertyT<int> cpropA = mesh_.request_cell_property<int>("index");
+    CellPropertyT<int> cpropB = serial.request_cell_property<int>("index");
+    for(HalfFaceIter hf_it = mesh_.halffaces_begin(); hf_it != mesh_.halffaces_end(); ++hf_it) {
+        hfpropA[*hf_it] = hfpropB[*hf_it] = hf_it->idx();
+    }
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) {
+        cpropA[*c_it] = cpropB[*c_it] = c_it->idx();
+    }
+
+    std::vector<bool> vertexTags(mesh_.n_vertices(), false);
+    std::vector<bool> cellTags(mesh_.n_cells(), false);
+    for(size_t i = 0; i < vertexTags.size(); i += 5) vertexTags[i] = true;
+    for(size_t i = 0; i < cellTags.size(); i += 7) cellTags[i] = true;
+    mesh_.delete_tagged(vertexTags, std::vector<bool>(), std::vector<bool>(), cellTags);
+    serial.delete_tagged(vertexTags, std::vector<bool>(), std::vector<bool>(), cellTags);
+
+    expectSameTopology(mesh_, serial);
+    expectValidCellVertexTable(mesh_);
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+        EXPECT_EQ(serial.vertex(*v_it), mesh_.vertex(*v_it));
+    }
+    for(HalfFaceIter hf_it = mesh_.halffaces_begin(); hf_it != mesh_.halffaces_end(); ++hf_it) {
+        EXPECT_EQ(hfpropB[*hf_it], hfpropA[*hf_it]);
+    }
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) {
+        EXPECT_EQ(cpropB[*c_it], cpropA[*c_it]);
+    }
+}
+
+TEST_F(TetrahedralMeshBase, GarbageCollectionKeepsIncidences) {
+
+    const int n = 5;
+    TetrahedralMesh reference;
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+        reference.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+    reference.add_cells(&cellVertices[0], cellVertices.size() / 4);
+    mesh_.enable_boundary_index();
+    mesh_.enable_cell_neighbor_table();
+
+    StatusAttrib status(mesh_);
+    StatusAttrib refStatus(reference);
+    for(int i = 0; i < (int)mesh_.n_cells(); i += 11) {
+        status[CellHandle(i)].set_deleted(true);
+        refStatus[CellHandle(i)].set_deleted(true);
+    }
+    status[VertexHandle(62)].set_deleted(true);
+    refStatus[VertexHandle(62)].set_deleted(true);
+
+    // The incidences of the mesh are renumbered in place,
+    // the ones of the reference are computed from scratch
+    status.garbage_collection(false);
+    reference.enable_bottom_up_incidences(false);
+    refStatus.garbage_collection(false);
+    reference.enable_bottom_up_incidences(true);
+
+    expectSameTopology(mesh_, reference);
+    for(VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it) {
+        std::vector<HalfEdgeHandle> hesA, hesB;
+        for(VertexOHalfEdgeIter voh_it = mesh_.voh_iter(*v_it); voh_it.valid(); ++voh_it) {
+            hesA.push_back(*voh_it);
+        }
+        for(VertexOHalfEdgeIter voh_it = reference.voh_iter(*v_it); voh_it.valid(); ++voh_it) {
+            hesB.push_back(*voh_it);
+        }
+        EXPECT_EQ(hesB, hesA);
+    }
+    expectValidBoundaryIndex(mesh_);
+    expectValidCellNeighborTable(mesh_);
+}
+
+TEST_F(TetrahedralMeshBase, SlotReuse) {
+
+    const int n = 3;
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+
+    mesh_.enable_edge_index();
+    mesh_.enable_face_index();
+    mesh_.enable_boundary_index();
+    mesh_.enable_vertex_cell_incidences();
+    mesh_.enable_cell_vertex_table();
+    mesh_.enable_cell_neighbor_table();
+    mesh_.enable_deferred_deletion(true);
+    mesh_.enable_slot_reuse();
+    EXPECT_TRUE(mesh_.has_slot_reuse());
+
+    const size_t nv = mesh_.n_vertices();
+    const size_t ne = mesh_.n_edges();
+    const size_t nf = mesh_.n_faces();
+    const size_t nc = mesh_.n_cells();
+
+    CellPropertyT<int> cprop = mesh_.request_cell_property<int>("index", -1);
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) {
+        cprop[*c_it] = c_it->idx();
+    }
+
+    // The center vertex and all its incident entities
+    const VertexHandle center(13);
+    std::vector<std::vector<VertexHandle> > stars;
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) {
+        const std::vector<VertexHandle> vs = mesh_.get_cell_vertices(*c_it);
+        if(std::find(vs.begin(), vs.end(), center) != vs.end()) stars.push_back(vs);
+    }
+    ASSERT_FALSE(stars.empty());
+    mesh_.delete_vertex(center);
+    EXPECT_TRUE(mesh_.is_deleted(center));
+
+    // Rebuild the star in the freed slots
+    EXPECT_EQ(center, mesh_.add_vertex(Vec3d(1.0, 1.0, 1.5)));
+    EXPECT_EQ(Vec3d(1.0, 1.0, 1.5), mesh_.vertex(center));
+    for(size_t i = 0; i < stars.size(); ++i) {
+        const CellHandle ch = mesh_.add_cell(stars[i]);
+        ASSERT_TRUE(ch.is_valid());
+        EXPECT_LT((size_t)ch.idx(), nc);
+        EXPECT_EQ(-1, cprop[ch]);
+    }
+
+    EXPECT_EQ(nv, mesh_.n_vertices());
+    EXPECT_EQ(ne, mesh_.n_edges());
+    EXPECT_EQ(nf, mesh_.n_faces());
+    EXPECT_EQ(nc, mesh_.n_cells());
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) {
+        EXPECT_FALSE(mesh_.is_deleted(*c_it));
+    }
+
+    expectValidFaceIndex(mesh_);
+    for(EdgeIter e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) {
+        const OpenVolumeMeshEdge& e = mesh_.edge(*e_it);
+        EXPECT_EQ(mesh_.halfedge_handle(*e_it, 0), mesh_.halfedge(e.from_vertex(), e.to_vertex()));
+    }
+    expectValidBoundaryIndex(mesh_);
+    expectValidVertexCellIncidences(mesh_);
+    expectValidCellVertexTable(mesh_);
+    expectValidCellNeighborTable(mesh_);
+
+    // Nothing is left to collect
+    mesh_.collect_garbage();
+    EXPECT_EQ(nc, mesh_.n_cells());
+}
+
+TEST_F(TetrahedralMeshBase, SetEdgeAndFace) {
+
+    const int n = 3;
+    for(int i = 0; i < n * n * n; ++i) {
+        mesh_.add_vertex(Vec3d(i % n, (i / n) % n, i / (n * n)));
+    }
+    const std::vector<int> cellVertices = tetGridCellVertices(n);
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 4);
+
+    mesh_.enable_face_index();
+    mesh_.enable_boundary_index();
+    mesh_.enable_vertex_cell_incidences();
+    mesh_.enable_cell_vertex_table();
+    mesh_.enable_cell_halfface_adjacency();
+
+    // Replace the center vertex by a new one
+    const VertexHandle center(13);
+    const VertexHandle vh = mesh_.add_vertex(mesh_.vertex(center));
+    std::vector<EdgeHandle> edges;
+    for(VertexOHalfEdgeIter voh_it = mesh_.voh_iter(center); voh_it.valid(); ++voh_it) {
+        edges.push_back(mesh_.edge_handle(*voh_it));
+    }
+    for(std::vector<EdgeHandle>::const_iterator e_it = edges.begin(); e_it != edges.end(); ++e_it) {
+        const OpenVolumeMeshEdge e = mesh_.edge(*e_it);
+        mesh_.set_edge(*e_it, e.from_vertex() == center ? vh : e.from_vertex(),
+                       e.to_vertex() == center ? vh : e.to_vertex());
+    }
+    EXPECT_EQ(0u, mesh_.valence(center));
+
+    // Start each face at its second halfedge
+    for(FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+        std::vector<HalfEdgeHandle> hes = mesh_.face(*f_it).halfedges();
+        std::rotate(hes.begin(), hes.begin() + 1, hes.end());
+        mesh_.set_face(*f_it, hes);
+    }
+
+    expectValidFaceIndex(mesh_);
+    expectValidBoundaryIndex(mesh_);
+    expectValidVertexCellIncidences(mesh_);
+    expectValidCellVertexTable(mesh_);
+    expectValidHalfFaceAdjacency(mesh_);
+}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <set>
+
 #include <gtest/gtest.h>
 
 #include <Unittests/unittests_common.hh>
@@ -146,3 +149,252 @@ TEST_F(HexahedralMeshBase, RangeForTest) {
     for (const auto& vh: constref.vertices()) { _dummy = vh;}
 }
 #endif
+
+TEST_F(TetrahedralMeshBase, StaticKernelIteratorTest) {
+
+    StaticTetrahedralMeshV3d smesh;
+    generateTetrahedralMesh(smesh);
+
+    smesh.delete_cell(CellHandle(0));
+    smesh.delete_vertex(VertexHandle(2));
+
+    // The polymorphic interface still works
+    const TopologyKernel& kernel = smesh;
+    EXPECT_EQ(smesh.n_vertices(), kernel.n_vertices());
+    EXPECT_EQ(smesh.n_cells(), kernel.n_cells());
+
+    std::vector<VertexHandle> vertices;
+    for(VertexIter v_it = kernel.vertices_begin(); v_it != kernel.vertices_end(); ++v_it) {
+        vertices.push_back(*v_it);
+    }
+    std::vector<VertexHandle> static_vertices;
+    for(StaticTetrahedralMeshV3d::StaticVertexIter v_it = smesh.static_vertices().begin();
+            v_it != smesh.static_vertices().end(); ++v_it) {
+        static_vertices.push_back(*v_it);
+    }
+    EXPECT_EQ(vertices, static_vertices);
+    EXPECT_EQ(smesh.n_vertices() - 1u, static_vertices.size());
+
+    std::vector<HalfFaceHandle> halffaces;
+    for(HalfFaceIter hf_it = kernel.halffaces_begin(); hf_it != kernel.halffaces_end(); ++hf_it) {
+        halffaces.push_back(*hf_it);
+    }
+    std::vector<HalfFaceHandle> static_halffaces;
+    for(StaticTetrahedralMeshV3d::StaticHalfFaceIter hf_it = smesh.static_halffaces().begin();
+            hf_it != smesh.static_halffaces().end(); ++hf_it) {
+        static_halffaces.push_back(*hf_it);
+    }
+    EXPECT_EQ(halffaces, static_halffaces);
+
+    size_t n_cells = 0;
+    for(StaticTetrahedralMeshV3d::StaticCellIter c_it = smesh.static_cells().begin();
+            c_it != smesh.static_cells().end(); ++c_it) {
+        EXPECT_FALSE(smesh.is_deleted(*c_it));
+        ++n_cells;
+    }
+    size_t n_cells_dynamic = 0;
+    for(CellIter c_it = kernel.cells_begin(); c_it != kernel.cells_end(); ++c_it) {
+        ++n_cells_dynamic;
+    }
+    EXPECT_EQ(n_cells_dynamic, n_cells);
+}
+
+TEST_F(TetrahedralMeshBase, VertexCirculatorsHighValence) {
+
+    // Fan of tetrahedra around the edge (0, 1), more than the
+    // circulators store without allocating
+    const int n_ring = 80;
+    mesh_.add_vertices(2 + n_ring);
+
+    std::vector<int> tets;
+    for(int i = 0; i < n_ring; ++i) {
+        const int cell[4] = { 0, 1, 2 + i, 2 + (i + 1) % n_ring };
+        tets.insert(tets.end(), cell, cell + 4);
+    }
+    mesh_.add_cells(&tets[0], n_ring);
+
+    std::vector<CellHandle> cells;
+    for(VertexCellIter vc_it = mesh_.vc_iter(VertexHandle(0)); vc_it.valid(); ++vc_it) {
+        cells.push_back(*vc_it);
+    }
+    ASSERT_EQ((size_t)n_ring, cells.size());
+    for(int i = 0; i < n_ring; ++i) {
+        EXPECT_EQ(CellHandle(i), cells[i]);
+    }
+
+    std::vector<FaceHandle> faces;
+    for(VertexFaceIter vf_it = mesh_.vf_iter(VertexHandle(0)); vf_it.valid(); ++vf_it) {
+        faces.push_back(*vf_it);
+    }
+    std::vector<FaceHandle> expected;
+    for(FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+        const std::vector<VertexHandle> vs = mesh_.get_halfface_vertices(mesh_.halfface_handle(*f_it, 0));
+        if(std::find(vs.begin(), vs.end(), VertexHandle(0)) != vs.end()) expected.push_back(*f_it);
+    }
+    EXPECT_EQ(2u * n_ring, faces.size());
+    EXPECT_EQ(expected, faces);
+
+    // Copies continue where the original stands
+    VertexCellIter vc_it = mesh_.vc_iter(VertexHandle(0));
+    vc_it += 70;
+    VertexCellIter vc_copy = vc_it;
+    ++vc_copy;
+    EXPECT_EQ(CellHandle(70), *vc_it);
+    EXPECT_EQ(CellHandle(71), *vc_copy);
+}
+
+TEST_F(HexahedralMeshBase, EntityRangeTest) {
+
+    mesh_.enable_deferred_deletion(true);
+    generateHexahedralMesh(mesh_);
+
+    // Without deleted entities, the ranges contain all handles
+    EXPECT_TRUE(mesh_.cell_range().contiguous());
+    EXPECT_EQ(mesh_.n_cells(), mesh_.cell_range().size());
+    EXPECT_EQ(mesh_.n_halffaces(), mesh_.halfface_range().size());
+
+    int n_cells = 0;
+    for(EntityRange<CellHandle>::iterator c_it = mesh_.cell_range().begin();
+            c_it != mesh_.cell_range().end(); ++c_it, ++n_cells) {
+        EXPECT_EQ(CellHandle(n_cells), *c_it);
+    }
+    EXPECT_EQ((int)mesh_.n_cells(), n_cells);
+
+    mesh_.delete_cell(CellHandle(0));
+    mesh_.delete_edge(EdgeHandle(5));
+
+    EXPECT_FALSE(mesh_.cell_range().contiguous());
+
+    std::vector<EdgeHandle> edges, range_edges;
+    for(EdgeIter e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it) edges.push_back(*e_it);
+    for(EntityRange<EdgeHandle>::iterator e_it = mesh_.edge_range().begin();
+            e_it != mesh_.edge_range().end(); ++e_it) range_edges.push_back(*e_it);
+    EXPECT_EQ(edges, range_edges);
+    EXPECT_EQ(edges.size(), mesh_.edge_range().size());
+
+    std::vector<HalfEdgeHandle> halfedges, range_halfedges;
+    for(HalfEdgeIter he_it = mesh_.halfedges_begin(); he_it != mesh_.halfedges_end(); ++he_it) halfedges.push_back(*he_it);
+    for(EntityRange<HalfEdgeHandle>::iterator he_it = mesh_.halfedge_range().begin();
+            he_it != mesh_.halfedge_range().end(); ++he_it) range_halfedges.push_back(*he_it);
+    EXPECT_EQ(halfedges, range_halfedges);
+
+    std::vector<HalfFaceHandle> halffaces, range_halffaces;
+    for(HalfFaceIter hf_it = mesh_.halffaces_begin(); hf_it != mesh_.halffaces_end(); ++hf_it) halffaces.push_back(*hf_it);
+    for(EntityRange<HalfFaceHandle>::iterator hf_it = mesh_.halfface_range().begin();
+            hf_it != mesh_.halfface_range().end(); ++hf_it) range_halffaces.push_back(*hf_it);
+    EXPECT_EQ(halffaces, range_halffaces);
+
+    std::vector<CellHandle> cells, range_cells;
+    for(CellIter c_it = mesh_.cells_begin(); c_it != mesh_.cells_end(); ++c_it) cells.push_back(*c_it);
+    for(EntityRange<CellHandle>::iterator c_it = mesh_.cell_range().begin();
+            c_it != mesh_.cell_range().end(); ++c_it) range_cells.push_back(*c_it);
+    EXPECT_EQ(cells, range_cells);
+
+    // After garbage collection, everything is contiguous again
+    mesh_.collect_garbage();
+    EXPECT_TRUE(mesh_.edge_range().contiguous());
+    EXPECT_TRUE(mesh_.cell_range().contiguous());
+    EXPECT_EQ(mesh_.n_cells(), mesh_.cell_range().size());
+}
+
+// Reference k-ring: all entities within _k steps of the 1-ring circulators, without _h
+template <class CirculatorT, class HandleT>
+std::vector<HandleT> nestedCirculatorKRing(const TopologyKernel& _mesh, const HandleT& _h, unsigned int _k) {
+
+    std::set<HandleT> ring, frontier;
+    frontier.insert(_h);
+    ring.insert(_h);
+    for(unsigned int d = 0; d < _k; ++d) {
+        std::set<HandleT> next;
+        for(typename std::set<HandleT>::const_iterator it = frontier.begin(); it != frontier.end(); ++it) {
+            for(CirculatorT c_it(*it, &_mesh); c_it.valid(); ++c_it) {
+                if(ring.insert(*c_it).second) next.insert(*c_it);
+            }
+        }
+        frontier.swap(next);
+    }
+    ring.erase(_h);
+    return std::vector<HandleT>(ring.begin(), ring.end());
+}
+
+TEST_F(HexahedralMeshBase, KRingTest) {
+
+    // Grid of 4 x 4 x 4 hexahedra
+    const int n = 5;
+    mesh_.add_vertices(n * n * n);
+    std::vector<int> cellVertices;
+    for(int k = 0; k < n - 1; ++k) {
+        for(int j = 0; j < n - 1; ++j) {
+            for(int i = 0; i < n - 1; ++i) {
+                const int v = (k * n + j) * n + i;
+                const int cv[8] = { v, v + 1, v + n + 1, v + n,
+                                    v + n * n, v + n * n + n, v + n * n + n + 1, v + n * n + 1 };
+                cellVertices.insert(cellVertices.end(), cv, cv + 8);
+            }
+        }
+    }
+    mesh_.add_cells(&cellVertices[0], cellVertices.size() / 8);
+
+    KRingScratch scratch;
+    std::vector<VertexHandle> vertices;
+    std::vector<CellHandle> cells;
+
+    // A corner vertex has three neighbors
+    mesh_.vertex_k_ring(VertexHandle(0), 1, vertices, scratch);
+    EXPECT_EQ(3u, vertices.size());
+
+    for(unsigned int k = 0; k < 4; ++k) {
+        for(int v = 0; v < n * n * n; v += 7) {
+            mesh_.vertex_k_ring(VertexHandle(v), k, vertices, scratch);
+            std::sort(vertices.begin(), vertices.end());
+            EXPECT_EQ(nestedCirculatorKRing<VertexVertexIter>(mesh_, VertexHandle(v), k), vertices);
+        }
+        for(int c = 0; c < (int)mesh_.n_cells(); c += 5) {
+            mesh_.cell_k_ring(CellHandle(c), k, cells, scratch);
+            std::sort(cells.begin(), cells.end());
+            EXPECT_EQ(nestedCirculatorKRing<CellCellIter>(mesh_, CellHandle(c), k), cells);
+        }
+    }
+
+    // Results are ordered by distance
+    mesh_.cell_k_ring(CellHandle(0), 2, cells);
+    ASSERT_EQ(9u, cells.size());
+    std::sort(cells.begin(), cells.begin() + 3);
+    EXPECT_EQ(CellHandle(1), cells[0]);
+    EXPECT_EQ(CellHandle(4), cells[1]);
+    EXPECT_EQ(CellHandle(16), cells[2]);
+
+    // Deleted cells are skipped
+    mesh_.enable_deferred_deletion(true);
+    mesh_.delete_cell(CellHandle(1));
+    mesh_.cell_k_ring(CellHandle(0), 1, cells, scratch);
+    EXPECT_EQ(2u, cells.size());
+}
+
+TEST(DeletionMaskTest, ScanAndErase) {
+
+    DeletionMask mask;
+    for(int i = 0; i < 200; ++i) mask.push_back(i % 3 == 0 || (i >= 64 && i < 130));
+
+    EXPECT_EQ(1u, mask.next_alive(0));
+    EXPECT_EQ(2u, mask.next_alive(2));
+    EXPECT_EQ(130u, mask.next_alive(63));
+    EXPECT_EQ(199u, mask.next_alive(198));
+    EXPECT_EQ(200u, mask.next_alive(200));
+
+    size_t n_deleted = 0;
+    for(size_t i = 0; i < mask.size(); ++i) n_deleted += mask[i];
+    EXPECT_EQ(n_deleted, mask.count());
+
+    mask.erase(10, 140);
+    EXPECT_EQ(70u, mask.size());
+    for(size_t i = 10; i < mask.size(); ++i) {
+        EXPECT_EQ((i + 130) % 3 == 0, mask[i]);
+    }
+
+    mask.resize(5);
+    EXPECT_EQ(2u, mask.count());
+    mask.set(0, false);
+    mask.set(3, false);
+    EXPECT_TRUE(mask.none());
+}